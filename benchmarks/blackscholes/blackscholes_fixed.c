@@ -6,6 +6,8 @@
 
 #ifdef FIXED
 #include "../../dpu/lut_fixed.c"
+#elif defined POLY_MINIMAX_FIXED
+#include "../../dpu/poly_minimax_fixed.c"
 #else
 #include "../../dpu/lut_fixed_interpolate.c"
 #endif
@@ -118,6 +120,9 @@ int BlkSchlsEqEuroNoDiv( int sptprice,
 
 
 int main(){
+#ifdef TABLE_STAGING_DPU
+    table_staging();
+#endif
     for (unsigned int global_index = 0; global_index < used_rows; global_index += LOCAL_ROWS * NR_TASKLETS) {
 
 
@@ -8,7 +8,11 @@
 #if defined FIXED
 #include "../../host/lut_fixed_host.c"
 char method[]="lut_fixed";
+#elif defined POLY_MINIMAX_FIXED
+#include "../../host/poly_minimax_host.c"
+char method[]="poly_minimax_fixed";
 #else
+#define LUT_FIXED_INTERPOLATE // The host file needs to know which tables are interpolated
 #include "../../host/lut_fixed_host.c"
 char method[]="lut_fixed_interpolate";
 #endif
@@ -17,10 +17,18 @@
 #include "../../dpu/lut_multi_interpolate.c"
 #elif defined LUT_DIRECT
 #include "../../dpu/lut_direct.c"
+#elif defined LUT_SPLINE
+#include "../../dpu/lut_spline.c"
+#elif defined LUT_BIPARTITE
+#include "../../dpu/lut_bipartite.c"
+#elif defined POLY_MINIMAX
+#include "../../dpu/poly_minimax.c"
 #elif defined POLYNOMIAL
 #include "../polynomial.c"
 #endif
 
+#include "../../dpu/_stream.c"
+
 #define fptype float
 
 typedef struct OptionData_ {
@@ -41,9 +49,8 @@ __host int used_rows = ROWS_PER_TASKLET * NR_TASKLETS;
 __mram_noinit float price[NR_TASKLETS * ROWS_PER_TASKLET];
 __mram_noinit OptionData option[NR_TASKLETS * ROWS_PER_TASKLET];
 
-#define LOCAL_ROWS 2
-OptionData local[LOCAL_ROWS * NR_TASKLETS];
-float local_price[LOCAL_ROWS * NR_TASKLETS];
+// Options and prices share the stream buffer of each tasklet
+#define LOCAL_ROWS STREAM_BLOCK_SIZE(sizeof(OptionData) + sizeof(float))
 
 // Cumulative Normal Distribution Function
 // See Hull, Section 11.8, P.243-244
@@ -172,6 +179,12 @@ fptype BlkSchlsEqEuroNoDiv( fptype sptprice,
 #elif defined LUT_MULTI_INTERPOLATE
     NofXd1 = cndf( d1 );
     NofXd2 = cndf( d2 );
+#elif defined LUT_SPLINE
+    NofXd1 = cndf( d1 );
+    NofXd2 = cndf( d2 );
+#elif defined POLY_MINIMAX
+    NofXd1 = cndf( d1 );
+    NofXd2 = cndf( d2 );
 #else
     NofXd1 = CNDF( d1 );
     NofXd2 = CNDF( d2 );
@@ -191,24 +204,30 @@ fptype BlkSchlsEqEuroNoDiv( fptype sptprice,
 
 
 int main(){
-    for (unsigned int global_index = 0; global_index < used_rows; global_index += LOCAL_ROWS * NR_TASKLETS) {
+#ifdef TABLE_STAGING_DPU
+    table_staging();
+#endif
+    OptionData *local = (OptionData *) stream_tasklet_buffer();
+    float *local_price = (float *) &local[LOCAL_ROWS];
+    stream_t stream;
 
-        int local_start = me() * LOCAL_ROWS;
-        int local_end = local_start + LOCAL_ROWS;
+    for (stream_init(&stream, used_rows, LOCAL_ROWS); stream_next(&stream);) {
 
-        mram_read(&option[global_index + local_start], &local[local_start], sizeof(OptionData) * LOCAL_ROWS);
+        stream_read(&option[stream.start], local, sizeof(OptionData) * stream.count);
 
-        for (unsigned int local_index = local_start; (local_index < local_end) && (global_index + local_index < used_rows); local_index++) {
+        for (unsigned int local_index = 0; local_index < stream.count; local_index++) {
 
             if (!(local[local_index].strike == 0.0 || local[local_index].v == 0.0 || local[local_index].t == 0.0)) {
                 local_price[local_index] = BlkSchlsEqEuroNoDiv(local[local_index].s, local[local_index].strike,
                                                                local[local_index].r, local[local_index].v,
                                                                local[local_index].t,
                                                                local[local_index].OptionType == 80 ? 1 : 0);
+            } else {
+                local_price[local_index] = 0.0f;
             }
         }
 
-        mram_write(&local_price[local_start], &price[global_index + local_start], sizeof(int) * LOCAL_ROWS);
+        stream_write(local_price, &price[stream.start], sizeof(float) * stream.count);
 
     }
 
@@ -26,6 +26,15 @@
 #elif defined LUT_DIRECT
     #include "../../host/lut_direct_host.c"
     char method[]="lut_direct_interpolate";
+#elif defined LUT_SPLINE
+    #include "../../host/lut_spline_host.c"
+    char method[]="lut_spline";
+#elif defined LUT_BIPARTITE
+    #include "../../host/lut_bipartite_host.c"
+    char method[]="lut_bipartite";
+#elif defined POLY_MINIMAX
+    #include "../../host/poly_minimax_host.c"
+    char method[]="poly_minimax";
 #elif defined POLYNOMIAL
     char method[]="polynomial";
 #endif
@@ -137,10 +146,11 @@ int main (int argc, char **argv)
     DPU_FOREACH(set, dpu, i) {
         DPU_ASSERT(dpu_prepare_xfer(dpu, &data[i * used_rows]));
     }
-    DPU_ASSERT(dpu_push_xfer(set, DPU_XFER_TO_DPU, "option", 0, sizeof(OptionData) * used_rows, DPU_XFER_DEFAULT));
+    DPU_ASSERT(dpu_push_xfer(set, DPU_XFER_TO_DPU, "option", 0, sizeof(OptionData) * used_rows, DPU_XFER_ASYNC)); // Runs while the tables are generated
 
     gettimeofday(&begin_inner, 0);
 
+    // Setup the tables we need for cordic / lut, the first table transfer waits for the input
 #ifndef POLYNOMIAL
     broadcast_tables(set);
 #endif
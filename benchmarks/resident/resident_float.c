@@ -0,0 +1,72 @@
+#include <mram.h>
+#include <stdio.h>
+#include <defs.h>
+
+#ifdef CORDIC_F2F
+#include "../../dpu/cordic.c"
+#elif defined CORDIC_LUT
+#include "../../dpu/cordic_lut.c"
+#elif defined LUT_LDEXPF
+#include "../../dpu/lut_ldexpf.c"
+#elif defined LUT_LDEXPF_INTERPOLATE
+#include "../../dpu/lut_ldexpf_interpolate.c"
+#elif defined LUT_MULTI
+#include "../../dpu/lut_multi.c"
+#elif defined LUT_MULTI_INTERPOLATE
+#include "../../dpu/lut_multi_interpolate.c"
+#elif defined LUT_DIRECT
+#include "../../dpu/lut_direct.c"
+#elif defined LUT_DIRECT_LDEXPF
+#include "../../dpu/lut_direct_ldexpf.c"
+#elif defined LUT_SPLINE
+#include "../../dpu/lut_spline.c"
+#elif defined LUT_BIPARTITE
+#include "../../dpu/lut_bipartite.c"
+#endif
+
+#include "../../dpu/_resident.c"
+
+// Every function the method offers and that is compiled in
+const resident_function functions[RESIDENT_FUNCTIONS] = {
+#if defined CORDIC_F2F || defined CORDIC_LUT
+    [RESIDENT_SINF] = sinf, [RESIDENT_COSF] = cosf, [RESIDENT_TANF] = tanf,
+    [RESIDENT_SINHF] = sinhf, [RESIDENT_COSHF] = coshf, [RESIDENT_TANHF] = tanhf,
+    [RESIDENT_EXPF] = expf,
+#ifdef CORDIC_F2F
+    [RESIDENT_LOGF] = logf, [RESIDENT_SQRTF] = sqrtf,
+#endif
+#elif defined LUT_DIRECT || defined LUT_DIRECT_LDEXPF
+#if SIN_COS_TAN_ENABLED > 0
+    [RESIDENT_SINF] = sinf,
+#endif
+#if TANH_ENABLED > 0
+    [RESIDENT_TANHF] = tanhf,
+#endif
+#if GELU_ENABLED > 0
+    [RESIDENT_GELU] = gelu,
+#endif
+#else
+#if SIN_COS_TAN_ENABLED > 0
+    [RESIDENT_SINF] = sinf, [RESIDENT_COSF] = cosf, [RESIDENT_TANF] = tanf,
+#endif
+#if EXP_ENABLED > 0
+    [RESIDENT_EXPF] = expf,
+#endif
+#if LOG_ENABLED > 0
+    [RESIDENT_LOGF] = logf,
+#endif
+#if SQRT_ENABLED > 0
+    [RESIDENT_SQRTF] = sqrtf,
+#endif
+#if CNDF_ENABLED > 0 && (defined LUT_LDEXPF_INTERPOLATE || defined LUT_MULTI_INTERPOLATE || defined LUT_SPLINE)
+    [RESIDENT_CNDF] = cndf,
+#endif
+#endif
+};
+
+int main(){
+#ifdef TABLE_STAGING_DPU
+    table_staging();
+#endif
+    return resident_serve(functions);
+}
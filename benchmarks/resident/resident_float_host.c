@@ -0,0 +1,188 @@
+#include <assert.h>
+#include <dpu.h>
+#include <dpu_log.h>
+#include <stdio.h>
+#include <math.h>
+#include <sys/time.h>
+
+#ifdef CORDIC_F2F
+    #include "../../host/cordic_host.c"
+    char method[]="cordic_f2f";
+#elif defined CORDIC_LUT
+    #include "../../host/cordic_lut_host.c"
+    char method[]="cordic_lut";
+#elif defined LUT_LDEXPF
+    #include "../../host/lut_ldexpf_host.c"
+    char method[]="lut_ldexpf_nointerpolate";
+#elif defined LUT_LDEXPF_INTERPOLATE
+    #include "../../host/lut_ldexpf_host.c"
+    char method[]="lut_ldexpf_interpolate";
+#elif defined LUT_MULTI
+    #include "../../host/lut_multi_host.c"
+    char method[]="lut_multi_nointerpolate";
+#elif defined LUT_MULTI_INTERPOLATE
+    #include "../../host/lut_multi_host.c"
+    char method[]="lut_multi_interpolate";
+#elif defined LUT_DIRECT
+    #include "../../host/lut_direct_host.c"
+    char method[]="lut_direct_interpolate";
+#elif defined LUT_DIRECT_LDEXPF
+    #include "../../host/lut_direct_ldexpf_host.c"
+    char method[]="lut_direct_ldexpf_interpolate";
+#elif defined LUT_SPLINE
+    #include "../../host/lut_spline_host.c"
+    char method[]="lut_spline";
+#elif defined LUT_BIPARTITE
+    #include "../../host/lut_bipartite_host.c"
+    char method[]="lut_bipartite";
+#endif
+
+#include "../../host/_resident_host.c"
+
+#ifndef DPU_BINARY
+#define DPU_BINARY "bin/resident_float"
+#endif
+
+// Size of the small batches the input is split into
+#ifndef BATCH_SIZE
+#define BATCH_SIZE 4096
+#endif
+
+// Function that is applied to every input (see _resident_host.c)
+#ifndef FUNCTION
+#define FUNCTION RESIDENT_EXPF
+#endif
+
+float *input;
+float *output;
+
+
+int main (int argc, char **argv)
+{
+    FILE *file;
+    int i;
+    int numOptions;
+    int rv;
+
+    if (argc != 3) {
+        printf("Usage:\n\t%s <inputFile> <outputFile>\n", argv[0]);
+        exit(1);
+    }
+    char *inputFile = argv[1];
+    char *outputFile = argv[2];
+
+    //Read input data from file
+    file = fopen(inputFile, "r");
+
+    if(file == NULL) {
+        printf("ERROR: Unable to open file `%s'.\n", inputFile);
+        exit(1);
+    }
+    rv = fscanf(file, "%i", &numOptions);
+    if(rv != 1) {
+        printf("ERROR: Unable to read from file `%s'.\n", inputFile);
+        fclose(file);
+        exit(1);
+    }
+
+    input = (float*)malloc(numOptions*sizeof(float));
+    output = (float*)malloc(numOptions*sizeof(float));
+    for (i = 0; i < numOptions; ++i)
+    {
+        rv = fscanf(file, "%f", &input[i]);
+        if(rv != 1) {
+            printf("ERROR: Unable to read from file `%s'.\n", inputFile);
+            fclose(file);
+            exit(1);
+        }
+    }
+    rv = fclose(file);
+    if(rv != 0) {
+        printf("ERROR: Unable to close file `%s'.\n", inputFile);
+        exit(1);
+    }
+
+    // Split the input into small batches
+    int nr_batches = (numOptions + BATCH_SIZE - 1) / BATCH_SIZE;
+    resident_batch *batches = malloc(nr_batches * sizeof(resident_batch));
+    for (i = 0; i < nr_batches; i++) {
+        int count = numOptions - i * BATCH_SIZE < BATCH_SIZE ? numOptions - i * BATCH_SIZE : BATCH_SIZE;
+        batches[i] = (resident_batch) {FUNCTION, &input[i * BATCH_SIZE], &output[i * BATCH_SIZE], count};
+    }
+
+    // Start measuring time
+    struct timeval begin, end, begin_inner, end_inner;
+    gettimeofday(&begin, 0);
+
+    // Allocate DPUs, load the program and broadcast the tables only once
+    struct dpu_set_t set;
+    DPU_ASSERT(dpu_alloc(DPU_ALLOCATE_ALL, NULL, &set));
+    resident_start(set, DPU_BINARY);
+
+    unsigned int dpu_amount;
+    DPU_ASSERT(dpu_get_nr_dpus(set, &dpu_amount));
+
+    gettimeofday(&begin_inner, 0);
+
+    // One submission per batch, as they would arrive one by one
+    for (i = 0; i < nr_batches; i++) {
+        resident_submit(set, &batches[i], 1);
+    }
+
+    gettimeofday(&end_inner, 0);
+    double single_time = (end_inner.tv_sec - begin_inner.tv_sec) + (end_inner.tv_usec - begin_inner.tv_usec)*1e-6;
+
+    // All batches at once, as many as fit are sent with each launch
+    gettimeofday(&begin_inner, 0);
+    resident_submit(set, batches, nr_batches);
+    gettimeofday(&end_inner, 0);
+    double queued_time = (end_inner.tv_sec - begin_inner.tv_sec) + (end_inner.tv_usec - begin_inner.tv_usec)*1e-6;
+
+    DPU_ASSERT(dpu_free(set));
+
+    // Stop measuring time and calculate the elapsed time
+    gettimeofday(&end, 0);
+    double total_time = (end.tv_sec - begin.tv_sec) + (end.tv_usec - begin.tv_usec)*1e-6;
+
+    printf("--- Resident DPU program ---\n");
+    printf("Method:                       %s\n", method);
+    printf("Time per Batch:               %.2e secs.\n", single_time / nr_batches);
+    printf("Time per Batch (queued):      %.2e secs.\n", queued_time / nr_batches);
+    printf("Total Time:                   %.2e secs.\n", total_time);
+    printf("Size of data:                 %d\n", numOptions);
+    printf("Batches:                      %d\n", nr_batches);
+    printf("DPUs:                         %d\n", dpu_amount);
+    printf("Tasklets:                     %d\n", NR_TASKLETS);
+
+    // Save Output to File
+    FILE *out_file = fopen("output/runs.csv", "a"); // write only
+    fprintf(out_file, "resident, float_%s, %d, %d, %d, %f, %f\n", method, numOptions, dpu_amount, NR_TASKLETS, total_time, single_time); // write to file
+
+    //Write results to output file
+    file = fopen(outputFile, "w");
+    if(file == NULL) {
+        printf("ERROR: Unable to open file `%s'.\n", outputFile);
+        exit(1);
+    }
+    rv = fprintf(file, "%i\n", numOptions);
+    if(rv < 0) {
+        printf("ERROR: Unable to write to file `%s'.\n", outputFile);
+        fclose(file);
+        exit(1);
+    }
+    for(i=0; i<numOptions; i++) {
+        rv = fprintf(file, "%.18f\n", output[i]);
+        if(rv < 0) {
+            printf("ERROR: Unable to write to file `%s'.\n", outputFile);
+            fclose(file);
+            exit(1);
+        }
+    }
+    rv = fclose(file);
+    if(rv != 0) {
+        printf("ERROR: Unable to close file `%s'.\n", outputFile);
+        exit(1);
+    }
+
+    return 0;
+}
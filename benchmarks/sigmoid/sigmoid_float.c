@@ -18,35 +18,42 @@
 #include "../../dpu/lut_multi_interpolate.c"
 #elif defined LUT_DIRECT
 #include "../../dpu/lut_direct.c"
+#elif defined LUT_SPLINE
+#include "../../dpu/lut_spline.c"
+#elif defined LUT_BIPARTITE
+#include "../../dpu/lut_bipartite.c"
+#elif defined POLY_MINIMAX
+#include "../../dpu/poly_minimax.c"
 #elif defined POLYNOMIAL
 #include "../polynomial.c"
 #endif
 
+#include "../../dpu/_stream.c"
+
 #define ROWS_PER_TASKLET 10000
 __mram_noinit float data_array[NR_TASKLETS * ROWS_PER_TASKLET];
 __host int used_rows = NR_TASKLETS * ROWS_PER_TASKLET;
 
-
-#define LOCAL_ROWS 4
-float local[LOCAL_ROWS * NR_TASKLETS];
+#define LOCAL_ROWS STREAM_BLOCK_SIZE(sizeof(float))
 
 int main(){
-    unsigned int start_row = me() * used_rows;
+#ifdef TABLE_STAGING_DPU
+    table_staging();
+#endif
+    float *local = (float *) stream_tasklet_buffer();
     float temp;
+    stream_t stream;
 
-    for (unsigned int global_index = 0; global_index < used_rows; global_index += LOCAL_ROWS * NR_TASKLETS) {
-
-        int local_start = me() * LOCAL_ROWS;
-        int local_end = local_start + LOCAL_ROWS;
+    for (stream_init(&stream, used_rows, LOCAL_ROWS); stream_next(&stream);) {
 
-        mram_read(&data_array[global_index + local_start], &local[local_start], sizeof(float) * LOCAL_ROWS);
+        stream_read(&data_array[stream.start], local, sizeof(float) * stream.count);
 
-        for (unsigned int local_index = local_start; (local_index < local_end) && (global_index + local_index < used_rows); local_index++) {
+        for (unsigned int local_index = 0; local_index < stream.count; local_index++) {
             temp = expf(-local[local_index]);
             local[local_index] = 1/(1+temp);
         }
 
-        mram_write(&local[local_start], &data_array[global_index + local_start], sizeof(float) * LOCAL_ROWS);
+        stream_write(local, &data_array[stream.start], sizeof(float) * stream.count);
 
     }
 
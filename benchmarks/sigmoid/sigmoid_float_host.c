@@ -26,6 +26,15 @@
 #elif defined LUT_DIRECT
     #include "../../host/lut_direct_host.c"
     char method[]="lut_direct_interpolate";
+#elif defined LUT_SPLINE
+    #include "../../host/lut_spline_host.c"
+    char method[]="lut_spline";
+#elif defined LUT_BIPARTITE
+    #include "../../host/lut_bipartite_host.c"
+    char method[]="lut_bipartite";
+#elif defined POLY_MINIMAX
+    #include "../../host/poly_minimax_host.c"
+    char method[]="poly_minimax";
 #elif defined POLYNOMIAL
     char method[]="polynomial";
 #endif
@@ -0,0 +1,146 @@
+#include <stdint.h>
+#include "_range_extensions.c"
+#include "_ldexpf.c"
+
+#ifndef ARGUMENT_REDUCTION
+#define ARGUMENT_REDUCTION
+
+/*
+ * Argument reduction for sin / cos / tan: x mod 2 * PI, in fixed point with FIXED_FRACTION_BITS bits after the comma
+ *
+ * The previous reduction (sin_cos_tan_range_extension_in()) multiplies with 1 / (2 * PI) and subtracts a multiple of 2 * PI
+ * in float. That costs two software float operations and loses all precision of the result for large inputs.
+ * Selected with -D SIN_COS_TAN_REDUCTION=xyz (DPU side only):
+ *  0: the previous float reduction
+ *  1: Cody-Waite in fixed point for |x| < 2^CODY_WAITE_LIMIT_EXPONENT, larger inputs use the previous float reduction
+ *  2: Cody-Waite as in 1, larger inputs use Payne-Hanek, which is exact for any finite input (default)
+ *
+ * Both Cody-Waite and Payne-Hanek only use integer operations. The result is in [0, 2 * PI) and accurate to a few
+ * units in the last fixed point place, independent of the size of the input.
+ *
+ * Basic Usage:
+ *
+ * int x_fixed = sin_cos_tan_reduction_fixed(x); // e.g. for sin_cos_quadrant()
+ * float x_float = sin_cos_tan_reduction(x);
+ */
+
+#ifndef SIN_COS_TAN_REDUCTION
+#define SIN_COS_TAN_REDUCTION 2
+#endif
+
+#if FIXED_FRACTION_BITS != 28
+#error "The constants of _argument_reduction.c are for 28 FIXED_FRACTION_BITS"
+#endif
+
+// Up to here, k * 2 * PI and the input fit into 64 bit fixed point numbers
+#define CODY_WAITE_LIMIT_EXPONENT 20
+#define CODY_WAITE_LIMIT_BITS ((unsigned int) (FLOAT_ZERO_EXPONENT + CODY_WAITE_LIMIT_EXPONENT) << FLOAT_MANTISSA_BITS)
+
+// 2 * PI with 60 bits after the comma, split into the fixed point value (28 bits after the comma) and the next 32 bits
+#define TWO_PI_FIXED 1686629713u
+#define TWO_PI_FIXED_REST 0x10B4611Au
+
+// 1 / (2 * PI) with 28 bits after the comma (rounded down)
+#define INVERSE_TWO_PI_FIXED 42722829u
+
+/*
+ * Bits of 1 / (2 * PI) after the comma, 32 per entry, for Payne-Hanek
+ * The leading zero entry stands for the bits before the comma, so that windows can start there
+ */
+static const uint32_t inverse_two_pi_bits[] = {
+    0x00000000,
+    0x28BE60DB, 0x9391054A, 0x7F09D5F4, 0x7D4D3770, 0x36D8A566, 0x4F10E410, 0x7F9458EA, 0xF7AEF158
+};
+
+// Helper Function: r for x = -|x| is 2 * PI - r (or 0)
+static inline int reduction_sign(unsigned int in_binary, unsigned int reduced) {
+    return (int) ((in_binary & FLOAT_SIGN_MASK) && reduced ? TWO_PI_FIXED - reduced : reduced);
+}
+
+/*
+ * Cody-Waite reduction for |x| < 2^CODY_WAITE_LIMIT_EXPONENT
+ *
+ * k = floor(|x| / (2 * PI)) is estimated with an integer multiplication, the estimate is at most one too small.
+ * k * 2 * PI is subtracted in two parts, so that the result keeps all fixed point bits.
+ */
+static inline int cody_waite_reduction(float x) {
+    unsigned int in_binary = * ( unsigned int * ) &x;
+
+    // |x| in fixed point, with 64 bits
+    int shift = (int) ((in_binary >> FLOAT_MANTISSA_BITS) & FLOAT_MAX_EXPONENT) - FLOAT_ZERO_EXPONENT - FLOAT_MANTISSA_BITS + FIXED_FRACTION_BITS;
+    uint64_t mantissa = (in_binary & FLOAT_MANTISSA_MASK) | FLOAT_OMITTED_BIT;
+    uint64_t x_fixed = shift >= 0 ? mantissa << shift : mantissa >> (shift < -(FLOAT_TOTAL_BITS - 1) ? FLOAT_TOTAL_BITS - 1 : -shift);
+
+    // 16 bits after the comma are enough for the estimate of k
+    uint64_t k = ((x_fixed >> (FIXED_FRACTION_BITS - 12)) * INVERSE_TWO_PI_FIXED) >> (12 + FIXED_FRACTION_BITS);
+
+    uint64_t reduced = x_fixed - k * TWO_PI_FIXED - ((k * TWO_PI_FIXED_REST) >> 32);
+    if (reduced >= TWO_PI_FIXED) {
+        reduced -= TWO_PI_FIXED;
+    }
+
+    return reduction_sign(in_binary, (unsigned int) reduced);
+}
+
+/*
+ * Payne-Hanek reduction for any finite x
+ *
+ * With |x| = m * 2^e (m the 24 bit mantissa), only the bits e + 1 to e + 64 of 1 / (2 * PI) are needed for the fractional part
+ * of |x| / (2 * PI): the bits before give integers, the bits after change it by less than 2^-40.
+ * The lower 64 bits of m * window are that fractional part, which is multiplied with 2 * PI in the end.
+ */
+static inline int payne_hanek_reduction(float x) {
+    unsigned int in_binary = * ( unsigned int * ) &x;
+
+    int exponent = (int) ((in_binary >> FLOAT_MANTISSA_BITS) & FLOAT_MAX_EXPONENT) - FLOAT_ZERO_EXPONENT - FLOAT_MANTISSA_BITS;
+    uint64_t mantissa = (in_binary & FLOAT_MANTISSA_MASK) | FLOAT_OMITTED_BIT;
+
+    // Window of 64 bits, starting at bit e + 1 after the comma (the table starts 32 bits before the comma)
+    int first_bit = exponent + 32;
+    int index = first_bit >> 5;
+    int offset = first_bit & 31;
+    uint64_t window = ((uint64_t) inverse_two_pi_bits[index] << 32) | inverse_two_pi_bits[index + 1];
+    if (offset) {
+        window = (window << offset) | (inverse_two_pi_bits[index + 2] >> (32 - offset));
+    }
+
+    // Fractional part of |x| / (2 * PI) with 32 bits, times 2 * PI
+    uint64_t fraction = (mantissa * window) >> 32;
+    unsigned int reduced = (unsigned int) ((fraction * TWO_PI_FIXED) >> 32);
+
+    return reduction_sign(in_binary, reduced);
+}
+
+/*
+ *  Input Range: -MAX_FLOAT to +MAX_FLOAT
+ *  Output Range: 0 to 2 * PI (fixed point)
+ */
+static inline int sin_cos_tan_reduction_fixed(float x) {
+#if SIN_COS_TAN_REDUCTION == 0
+    return floating_to_fixed(sin_cos_tan_range_extension_in(x));
+#else
+    unsigned int in_binary = * ( unsigned int * ) &x;
+    if ((in_binary & FLOAT_EXPONENT_AND_MANTISSA_MASK) < CODY_WAITE_LIMIT_BITS) {
+        return cody_waite_reduction(x);
+    }
+#if SIN_COS_TAN_REDUCTION == 1
+    return floating_to_fixed(sin_cos_tan_range_extension_in(x));
+#else
+    return payne_hanek_reduction(x);
+#endif
+#endif
+}
+
+/*
+ *  Input Range: -MAX_FLOAT to +MAX_FLOAT
+ *  Output Range: 0 to 2 * PI
+ */
+static inline float sin_cos_tan_reduction(float x) {
+#if SIN_COS_TAN_REDUCTION == 0
+    return sin_cos_tan_range_extension_in(x);
+#else
+    return fixed_to_floating(sin_cos_tan_reduction_fixed(x));
+#endif
+}
+
+#endif
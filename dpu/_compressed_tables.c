@@ -0,0 +1,84 @@
+#include <stdint.h>
+#include "_ldexpf.c"
+#include "_table_cache.c"
+#include "_packed_tables.c"
+
+#ifndef COMPRESSED_TABLES_DPU
+#define COMPRESSED_TABLES_DPU
+
+/*
+ * Compressed tables with 16 bit entries (-D COMPRESSED_TABLES=1, needs to be set on host and DPU side)
+ *
+ * For the float tables of lut_ldexpf_interpolate.c and lut_multi_interpolate.c. Each block of
+ * 2^COMPRESSED_TABLE_BLOCK_BITS entries is stored as the line through its first and last value (base and slope as floats)
+ * and 16 bit residuals to that line, in fixed point with fraction_bits bits after the comma (chosen per block by the host).
+ * Within a block the residuals are tiny, so they are far more precise than float16 / bfloat16 values would be.
+ *
+ * With the block headers, an entry takes about 2.3 bytes instead of 4, so almost twice as many entries fit into WRAM.
+ * Every block also stores the residual of its last value (the first of the next block), so table[i + 1]
+ * is always found in the block of table[i]. Converting the residuals back only needs integer operations,
+ * but the lookups still need a few more float operations than with float tables.
+ *
+ * The <NAME>_TABLE_DELTA() macros of the methods keep working, the block headers are found as <table>_blocks.
+ * Not available together with INTEGER_INTERPOLATION, INTERLEAVED_TABLES, TABLE_CACHE or PACKED_TABLES.
+ *
+ * Basic Usage:
+ *
+ * __host TABLE_ENTRY table[TABLE_WORDS(1 << PRECISION)];
+ * COMPRESSED_TABLE_BLOCKS(__host, table, 1 << PRECISION)
+ * float base, delta;
+ * WRAM_TABLE_DELTA(table, TABLE_ID, lower_address, base, delta);
+ * return base + delta * diff;
+ */
+
+#ifndef COMPRESSED_TABLES
+#define COMPRESSED_TABLES 0 // This needs to match on CPU and DPU side!
+#endif
+
+#ifndef COMPRESSED_TABLE_BLOCK_BITS
+#define COMPRESSED_TABLE_BLOCK_BITS 6 // This needs to match on CPU and DPU side!
+#endif
+
+#define COMPRESSED_TABLE_BLOCK_SIZE (1 << COMPRESSED_TABLE_BLOCK_BITS)
+
+// This needs to match on CPU and DPU side!
+typedef struct {
+    float base; // First value of the block
+    float slope; // (last value - first value) / COMPRESSED_TABLE_BLOCK_SIZE
+    int32_t fraction_bits; // Fixed point format of the residuals
+    int32_t unused; // Keeps the blocks 8 byte aligned for MRAM
+} compressed_table_block;
+
+#if COMPRESSED_TABLES > 0
+#if INTEGER_INTERPOLATION > 0 || INTERLEAVED_TABLES > 0 || TABLE_CACHE > 0 || PACKED_TABLES > 0
+#error "COMPRESSED_TABLES can not be combined with INTEGER_INTERPOLATION, INTERLEAVED_TABLES, TABLE_CACHE or PACKED_TABLES"
+#endif
+
+// 16 bit residuals, COMPRESSED_TABLE_BLOCK_SIZE + 1 per block (padded to 8 bytes)
+#undef TABLE_WORDS
+#define TABLE_WORDS(entries) ((entries) + ((entries) >> COMPRESSED_TABLE_BLOCK_BITS) + 4)
+
+#define COMPRESSED_TABLE_BLOCKS(storage, table, entries) \
+    storage compressed_table_block table##_blocks[(entries) >> COMPRESSED_TABLE_BLOCK_BITS];
+
+// Same for WRAM and MRAM: the block header is read as a whole (a single DMA from MRAM)
+#define COMPRESSED_TABLE_DELTA(table, index, base, delta)                                                          \
+    do {                                                                                                           \
+        uint32_t block_index = (index) >> COMPRESSED_TABLE_BLOCK_BITS;                                             \
+        compressed_table_block block = (table##_blocks)[block_index];                                              \
+        int residual = (table)[(index) + block_index];                                                             \
+        int next_residual = (table)[(index) + block_index + 1];                                                    \
+        float position = fixed_to_floating_fraction((index) & (COMPRESSED_TABLE_BLOCK_SIZE - 1), 0);              \
+        (base) = block.base + block.slope * position + fixed_to_floating_fraction(residual, block.fraction_bits);  \
+        (delta) = block.slope + fixed_to_floating_fraction(next_residual - residual, block.fraction_bits);        \
+    } while (0)
+
+#undef WRAM_TABLE_DELTA
+#undef MRAM_TABLE_DELTA
+#define WRAM_TABLE_DELTA(table, table_id, index, base, delta) COMPRESSED_TABLE_DELTA(table, index, base, delta)
+#define MRAM_TABLE_DELTA(table, table_id, index, base, delta) COMPRESSED_TABLE_DELTA(table, index, base, delta)
+#else
+#define COMPRESSED_TABLE_BLOCKS(storage, table, entries)
+#endif
+
+#endif
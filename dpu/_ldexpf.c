@@ -94,6 +94,56 @@ float ldexpf(float in, int exponent) {
     return * ( float * ) &in_binary;
 }
 
+/*
+ * Conversion from floating point to fixed point notation with fraction_bits bits after the comma
+ * Does the same as if you would call (int) ldexpf(in, fraction_bits)
+ *
+ * The mantissa is shifted into place in one go and the two's complement is made without a branch.
+ * Behaviour at inputs outside the representable range is undefined, inputs too small for it become 0.
+ */
+static inline int floating_to_fixed_fraction(float in, int fraction_bits) {
+    unsigned int in_binary = * ( unsigned int * ) &in;
+
+    int shift = (int) ((in_binary >> FLOAT_MANTISSA_BITS) & FLOAT_MAX_EXPONENT) - FLOAT_ZERO_EXPONENT - FLOAT_MANTISSA_BITS + fraction_bits;
+    unsigned int mantissa = (in_binary & FLOAT_MANTISSA_MASK) | FLOAT_OMITTED_BIT;
+
+    // Shifts by 32 or more are undefined, a right shift by 31 already gives 0
+    mantissa = shift >= 0 ? mantissa << shift : mantissa >> (shift < -(FLOAT_TOTAL_BITS - 1) ? FLOAT_TOTAL_BITS - 1 : -shift);
+
+    // Make two's complement: negative is all ones for negative inputs, which inverts and adds 1
+    unsigned int negative = (unsigned int) ((int) in_binary >> (FLOAT_TOTAL_BITS - 1));
+    return (int) ((mantissa ^ negative) - negative);
+}
+
+/*
+ * Conversion from fixed point notation with fraction_bits bits after the comma back to floating point
+ * Does the same as if you would call (float) ldexpf(in, -fraction_bits), rounding towards zero
+ *
+ * Instead of normalizing one bit at a time, the highest set bit is found with count leading zeros
+ * (a single instruction on the DPU), moved to the top and from there to the position of the omitted bit.
+ * The result needs to be in the range of normal floats.
+ */
+static inline float fixed_to_floating_fraction(int in, int fraction_bits) {
+    unsigned int in_binary = * ( unsigned int * ) &in;
+
+    // Absolute value without a branch, see floating_to_fixed_fraction()
+    unsigned int negative = (unsigned int) (in >> (FLOAT_TOTAL_BITS - 1));
+    in_binary = (in_binary ^ negative) - negative;
+
+    // return 0 directly as count leading zeros is undefined for it
+    if (in_binary == 0) {
+        return 0.0f;
+    }
+
+    int leading_zeros = __builtin_clz(in_binary);
+    in_binary = (in_binary << leading_zeros) >> (FLOAT_EXPONENT_BITS);
+
+    // Combine sign, mantissa and exponent (the omitted bit still in the mantissa adds 1 to the exponent)
+    in_binary += (negative & FLOAT_SIGN_MASK) + ((unsigned int) (FLOAT_ZERO_EXPONENT - 1 + (FLOAT_TOTAL_BITS - 1) - fraction_bits - leading_zeros) << FLOAT_MANTISSA_BITS);
+
+    return  * ( float * ) &in_binary;
+}
+
 /*
  * Custom Conversion from floating point to fixed point notation
  * Does the same as if you would call (int) ldexpf(in, 23)
@@ -111,23 +161,7 @@ float ldexpf(float in, int exponent) {
  * Behaviour at inputs outside that range is undefined
  */
 int floating_to_fixed(float in) {
-    unsigned int in_binary = * ( unsigned int * ) &in;
-
-    unsigned int part = (in_binary >> FLOAT_MANTISSA_BITS);
-    int current_exponent = (int) part & FLOAT_MAX_EXPONENT;
-
-    // Bit shift mantissa for exponent
-    // This if statement is kind of redundant, cant we just shift negative amounts?
-    if (FLOAT_ZERO_EXPONENT - EXTRA_PRECISION > current_exponent) {
-        in_binary = ((in_binary & FLOAT_MANTISSA_MASK) | FLOAT_OMITTED_BIT) >> (FLOAT_ZERO_EXPONENT - current_exponent - EXTRA_PRECISION);
-    } else {
-        in_binary = ((in_binary & FLOAT_MANTISSA_MASK) | FLOAT_OMITTED_BIT) << (current_exponent - FLOAT_ZERO_EXPONENT + EXTRA_PRECISION);
-    }
-
-    // Make two's complement
-    if (part >> FLOAT_EXPONENT_BITS) in_binary = ~in_binary + 0x1;
-
-    return (int) in_binary;
+    return floating_to_fixed_fraction(in, FIXED_FRACTION_BITS);
 }
 
 /*
@@ -139,34 +173,7 @@ int floating_to_fixed(float in) {
  * always returns back a valid float but there might be sight loss of precision
  */
 float fixed_to_floating(int in) {
-    unsigned int in_binary = * ( unsigned int * ) &in;
-
-    unsigned int sign = in_binary >> (FLOAT_EXPONENT_BITS + FLOAT_MANTISSA_BITS);
-
-    if (sign) in_binary = ~in_binary + 0x1;
-
-    // return 0 directly as bitshift and wait operations would fail with it
-    if (in_binary == 0) {
-        return 0.0f;
-    }
-
-    // Normalize too big exponents
-    int exponent = FLOAT_ZERO_EXPONENT - 1 - EXTRA_PRECISION;
-    while(in_binary > (FLOAT_OMITTED_BIT << 1)) {
-        ++exponent;
-        in_binary >>= 1;
-    }
-
-    // Normalize too small exponents
-    while(in_binary < FLOAT_OMITTED_BIT) {
-        --exponent;
-        in_binary <<= 1;
-    }
-
-    // Combine sign, mantissa and exponent
-    in_binary += (exponent << FLOAT_MANTISSA_BITS) + (sign << (FLOAT_EXPONENT_BITS + FLOAT_MANTISSA_BITS));
-
-    return  * ( float * ) &in_binary;
+    return fixed_to_floating_fraction(in, FIXED_FRACTION_BITS);
 }
 
 
@@ -186,4 +193,47 @@ float frexpf(float in, int*exponent){
 
     return ldexpf(in, -(*exponent));
 }
+
+
+/*
+ * Fast variants of ldexpf() and frexpf() for normal (finite) floats and zero
+ *
+ * The exponent is changed with a single addition to the exponent bits, there is no handling of denormalized inputs,
+ * and results that would be denormalized, infinite or MAX_FLOAT are undefined.
+ * For all other inputs, the results are bit-identical to ldexpf() and frexpf() (see validation/dpu/ldexpf_fast_validation.c).
+ *
+ * With -D LDEXPF_FAST=1, ldexpf() and frexpf() are replaced by these everywhere in the library (e.g. in the address
+ * calculations of lut_ldexpf.c and the range extensions). Only use this if such inputs and results can not occur,
+ * e.g. exp() of large negative numbers gives a denormalized result.
+ */
+#ifndef LDEXPF_FAST
+#define LDEXPF_FAST 0
+#endif
+
+static inline float ldexpf_fast(float in, int exponent) {
+    unsigned int in_binary = * ( unsigned int * ) &in;
+
+    // Zero has no exponent that could be changed, the mask is all ones for any other input
+    unsigned int non_zero = - (unsigned int) ((in_binary & FLOAT_EXPONENT_AND_MANTISSA_MASK) != 0);
+    in_binary += ((unsigned int) exponent << FLOAT_MANTISSA_BITS) & non_zero;
+
+    return * ( float * ) &in_binary;
+}
+
+static inline float frexpf_fast(float in, int *exponent) {
+    unsigned int in_binary = * ( unsigned int * ) &in;
+
+    *exponent = (int) ((in_binary >> FLOAT_MANTISSA_BITS) & FLOAT_MAX_EXPONENT) - FLOAT_ZERO_EXPONENT;
+
+    // Replace the exponent with the one of 1.0, zero stays zero (see ldexpf_fast())
+    unsigned int non_zero = - (unsigned int) ((in_binary & FLOAT_EXPONENT_AND_MANTISSA_MASK) != 0);
+    in_binary = (in_binary & ~FLOAT_EXPONENT_MASK) | (((unsigned int) FLOAT_ZERO_EXPONENT << FLOAT_MANTISSA_BITS) & non_zero);
+
+    return * ( float * ) &in_binary;
+}
+
+#if LDEXPF_FAST > 0
+#define ldexpf(in, exponent) ldexpf_fast(in, exponent)
+#define frexpf(in, exponent) frexpf_fast(in, exponent)
+#endif
 #endif
\ No newline at end of file
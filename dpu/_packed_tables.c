@@ -0,0 +1,42 @@
+#include <stdint.h>
+#include <mram.h>
+
+#ifndef PACKED_TABLES_DPU
+#define PACKED_TABLES_DPU
+
+/*
+ * All tables of a method packed into one blob (-D PACKED_TABLES=1, needs to be set on host and DPU side)
+ *
+ * Without packing, the host broadcasts every table and every table parameter (e.g. exp_granularity_exponent) on its own.
+ * With packing, the host writes all tables one after the other to the start of the MRAM heap and collects their
+ * offsets and parameters in packed_tables_header. The whole setup then needs two broadcasts: the blob and the header.
+ *
+ * The DPU side finds the tables through the header, so table_name[i] keeps working.
+ * Packed tables always live in MRAM, <NAME>_STORE_IN_WRAM is ignored.
+ * Do not use the MRAM heap (DPU_MRAM_HEAP_POINTER) for anything else in programs with packed tables.
+ */
+
+#ifndef PACKED_TABLES
+#define PACKED_TABLES 0 // This needs to match on CPU and DPU side!
+#endif
+
+#define PACKED_TABLES_MAX_TABLES 8 // This needs to match on CPU and DPU side!
+
+// This needs to match on CPU and DPU side!
+typedef struct {
+    uint32_t offset; // Position of the table in the blob (in bytes)
+    union {
+        int32_t i;
+        float f;
+    } parameter; // Spacing of the table (e.g. granularity exponent), if the method needs one
+} packed_table_entry;
+
+#if PACKED_TABLES > 0
+__host packed_table_entry packed_tables_header[PACKED_TABLES_MAX_TABLES];
+
+#define PACKED_TABLE(type, table_id) ((__mram_ptr type *) ((__mram_ptr uint8_t *) DPU_MRAM_HEAP_POINTER + packed_tables_header[table_id].offset))
+#define PACKED_INT_PARAMETER(table_id) (packed_tables_header[table_id].parameter.i)
+#define PACKED_FLOAT_PARAMETER(table_id) (packed_tables_header[table_id].parameter.f)
+#endif
+
+#endif
@@ -0,0 +1,87 @@
+#include <stdint.h>
+
+#ifndef POLYNOMIAL_EVALUATION
+#define POLYNOMIAL_EVALUATION
+
+/*
+ * Evaluation of polynomials c[0] + c[1] * x + ... + c[degree] * x^degree
+ *
+ * Horner needs degree multiplications and additions, but every step depends on the one before.
+ * Estrin combines neighbouring coefficients into pairs (c[0] + c[1] * x, c[2] + c[3] * x, ...), then pairs of pairs with x^2, x^4, ...
+ * It needs a few more multiplications, but the dependency chain is only about log2(degree) steps long.
+ * Select it with -D POLY_ESTRIN=1.
+ *
+ * The fixed point versions use FIXED_FRACTION_BITS fractional bits for coefficients, input and output.
+ * With Estrin, the powers x^2, x^4 and (above degree 7) x^8 need to fit as well, so |x| should stay small.
+ */
+
+#ifndef POLY_ESTRIN
+#define POLY_ESTRIN 0
+#endif
+
+#define POLY_MAX_DEGREE 15
+
+// Fixed point multiplication, with a 64 bit intermediate result
+#define POLY_MULT(x, y) ((int32_t) (((int64_t) (x) * (y)) >> FIXED_FRACTION_BITS))
+
+static inline float poly_horner_float(const float c[], int degree, float x) {
+    float y = c[degree];
+    for (int i = degree - 1; i >= 0; i--) {
+        y = y * x + c[i];
+    }
+    return y;
+}
+
+static inline float poly_estrin_float(const float c[], int degree, float x) {
+    float pairs[POLY_MAX_DEGREE + 1];
+    int n = degree + 1;
+
+    for (int i = 0; i < n; i++) {
+        pairs[i] = c[i];
+    }
+    while (n > 1) {
+        for (int i = 0; 2 * i < n; i++) {
+            pairs[i] = (2 * i + 1 < n) ? pairs[2 * i] + pairs[2 * i + 1] * x : pairs[2 * i];
+        }
+        n = (n + 1) >> 1;
+        x = x * x;
+    }
+    return pairs[0];
+}
+
+static inline int32_t poly_horner_fixed(const int32_t c[], int degree, int32_t x) {
+    int32_t y = c[degree];
+    for (int i = degree - 1; i >= 0; i--) {
+        y = POLY_MULT(y, x) + c[i];
+    }
+    return y;
+}
+
+static inline int32_t poly_estrin_fixed(const int32_t c[], int degree, int32_t x) {
+    int32_t pairs[POLY_MAX_DEGREE + 1];
+    int n = degree + 1;
+
+    for (int i = 0; i < n; i++) {
+        pairs[i] = c[i];
+    }
+    while (n > 1) {
+        for (int i = 0; 2 * i < n; i++) {
+            pairs[i] = (2 * i + 1 < n) ? pairs[2 * i] + POLY_MULT(pairs[2 * i + 1], x) : pairs[2 * i];
+        }
+        n = (n + 1) >> 1;
+        if (n > 1) {
+            x = POLY_MULT(x, x); // Not after the last step, the next power could overflow
+        }
+    }
+    return pairs[0];
+}
+
+#if POLY_ESTRIN > 0
+#define poly_float poly_estrin_float
+#define poly_fixed poly_estrin_fixed
+#else
+#define poly_float poly_horner_float
+#define poly_fixed poly_horner_fixed
+#endif
+
+#endif
@@ -1,4 +1,5 @@
 #include "_range_extensions.c"
+#include "_argument_reduction.c"
 #include "_ldexpf.c"
 
 #ifndef QUADRANTS
@@ -99,7 +100,7 @@ static inline float sin_cos_tan_in_float(float x, int *quadrant){
 #ifdef NOWRAP
   return sin_cos_quadrant_float(x, quadrant);
 #else
-  return sin_cos_quadrant_float(sin_cos_tan_range_extension_in(x), quadrant);
+  return sin_cos_quadrant_float(sin_cos_tan_reduction(x), quadrant);
 #endif
 }
 
@@ -108,7 +109,7 @@ static inline int sin_cos_tan_in(float x, int *quadrant){
     #ifdef NOWRAP
         return sin_cos_quadrant(floating_to_fixed(x), quadrant);
     #else
-        return sin_cos_quadrant(floating_to_fixed(sin_cos_tan_range_extension_in(x)), quadrant);
+        return sin_cos_quadrant(sin_cos_tan_reduction_fixed(x), quadrant);
     #endif
 }
 
@@ -122,10 +123,24 @@ static inline int cos_to_sin_in(float x, int *quadrant){
     #ifdef NOWRAP
         return sin_cos_quadrant(floating_to_fixed(x) + cordic_quarter_circle, quadrant);
     #else
-        return sin_cos_quadrant(floating_to_fixed(sin_cos_tan_range_extension_in(x)) + cordic_quarter_circle, quadrant);
+        return sin_cos_quadrant(sin_cos_tan_reduction_fixed(x) + cordic_quarter_circle, quadrant);
     #endif
 }
 
+/*
+ * For the result theta of sin_cos_tan_in(), this is what cos_to_sin_in() gives for the same input,
+ * but the quadrant of sin_cos_tan_in() is kept (use cos_out() / cos_float_out() with it).
+ * So sin and cos of one input only need one range reduction.
+ */
+static inline int sin_to_cos_in(int theta){
+    return cordic_quarter_circle - theta;
+}
+
+// Same for the result of sin_cos_tan_in_float()
+static inline float sin_to_cos_in_float(float theta){
+    return (float) (M_PI * 0.5) - theta;
+}
+
 
 static inline float sin_out(int y, int *quadrant){
     return fixed_to_floating((*quadrant==QUAD1 || *quadrant==QUAD2) ? y : -y);
@@ -144,6 +159,10 @@ static inline float sin_float_out(float y, int *quadrant){
     return (*quadrant==QUAD1 || *quadrant==QUAD2) ? y : -y;
 }
 
+static inline float cos_float_out(float x, int *quadrant){
+    return (*quadrant==QUAD1 || *quadrant==QUAD4) ? x : -x;
+}
+
 static inline float tan_float_out(float x, float y, int *quadrant){
     float ret = (float) y  / (float) x;
     return (*quadrant==QUAD2 || *quadrant==QUAD4) ? - ret : ret;
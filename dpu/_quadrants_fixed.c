@@ -74,6 +74,15 @@ static inline int cos_to_sin_in(int x, int *quadrant){
     return sin_cos_quadrant(x + cordic_quarter_circle, quadrant);
 }
 
+/*
+ * For the result theta of sin_cos_tan_in(), this is what cos_to_sin_in() gives for the same input,
+ * but the quadrant of sin_cos_tan_in() is kept (use cos_out() with it).
+ * So sin and cos of one input only need one range reduction.
+ */
+static inline int sin_to_cos_in(int theta){
+    return cordic_quarter_circle - theta;
+}
+
 
 static inline int sin_out(int y, int *quadrant){
     return (*quadrant==QUAD1 || *quadrant==QUAD2) ? y : -y;
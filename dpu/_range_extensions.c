@@ -28,65 +28,23 @@
 /*
  *  Input Range: -MAX_FLOAT to +MAX_FLOAT
  *  Output Range: 0 to 2 * PI
+ *
+ *  Loses precision for large inputs, see _argument_reduction.c for the reductions used by the methods
  */
 static inline float sin_cos_tan_range_extension_in(float x) {
-    // Todo: Implement Payne-Hanek Algorithm
     x -= (float) (M_PI_2 * (float) ((int) (x * IP_M_2) - (int) (x < 0)));
     return x;
 }
 
 
-// Helper function needed for exp_range_extension_in()
+// Helper function needed for exp_range_extension_in(), fixed point with FLOAT_MANTISSA_BITS bits after the comma
 int floating_to_fixed_exp_helper(float in) {
-    unsigned int in_binary = * ( unsigned int * ) &in;
-
-    unsigned int part = (in_binary >> FLOAT_MANTISSA_BITS);
-    int current_exponent = (int) part & FLOAT_MAX_EXPONENT;
-
-    // Bit shift mantissa for exponent
-    // This if statement is kind of redundant, can't we just shift negative amounts?
-    if (FLOAT_ZERO_EXPONENT > current_exponent) {
-        in_binary = ((in_binary & FLOAT_MANTISSA_MASK) | FLOAT_OMITTED_BIT) >> (FLOAT_ZERO_EXPONENT - current_exponent);
-    } else {
-        in_binary = ((in_binary & FLOAT_MANTISSA_MASK) | FLOAT_OMITTED_BIT) << (current_exponent - FLOAT_ZERO_EXPONENT);
-    }
-
-    // Make two's complement
-    if (part >> FLOAT_EXPONENT_BITS) in_binary = ~in_binary + 0x1;
-
-    return (int) in_binary;
+    return floating_to_fixed_fraction(in, FLOAT_MANTISSA_BITS);
 }
 
 // Helper function needed for exp_range_extension_in()
 float fixed_to_floating_exp_helper(int in) {
-    unsigned int in_binary = * ( unsigned int * ) &in;
-
-    unsigned int sign = in_binary >> (FLOAT_EXPONENT_BITS + FLOAT_MANTISSA_BITS);
-
-    if (sign) in_binary = ~in_binary + 0x1;
-
-    // return 0 directly as bitshift and wait operations would fail with it
-    if (in_binary == 0) {
-        return 0.0f;
-    }
-
-    // Normalize too big exponents
-    int exponent = FLOAT_ZERO_EXPONENT - 1;
-    while(in_binary > (FLOAT_OMITTED_BIT << 1)) {
-        ++exponent;
-        in_binary >>= 1;
-    }
-
-    // Normalize too small exponents
-    while(in_binary < FLOAT_OMITTED_BIT) {
-        --exponent;
-        in_binary <<= 1;
-    }
-
-    // Combine sign, mantissa and exponent
-    in_binary += (exponent << FLOAT_MANTISSA_BITS) + (sign << (FLOAT_EXPONENT_BITS + FLOAT_MANTISSA_BITS));
-
-    return  * ( float * ) &in_binary;
+    return fixed_to_floating_fraction(in, FLOAT_MANTISSA_BITS);
 }
 
 /*
@@ -106,6 +64,28 @@ static inline float exp_range_extension_out(float y, int *exponent_2pow_integer)
 }
 
 
+/*
+ * sinh / cosh use the range extension of exp on |x| = k * log(2) + r, the reduced functions are sinh(r) and cosh(r).
+ * With e^r = cosh(r) + sinh(r) and e^-r = cosh(r) - sinh(r):
+ *  sinh(|x|) = 2^(k-1) * (e^r - 2^(-2k) * e^-r)
+ *  cosh(|x|) = 2^(k-1) * (e^r + 2^(-2k) * e^-r)
+ * For k = 0 the reduced values are the result, so small inputs don't lose precision through cancellation.
+ *
+ *  Input Range: sinh(r) and cosh(r) for exp_range_extension_in(|x|, &k)
+ *  Output Range: sinh(|x|) and cosh(|x|)
+ */
+static inline void sinh_cosh_range_extension_out(float *sinh_y, float *cosh_y, int *exponent_2pow_integer){
+    int k = *exponent_2pow_integer;
+    if (k > 0) {
+        float exp_y = *cosh_y + *sinh_y;
+        // For larger k, 2^(-2k) * e^-r is below the precision of e^r
+        float exp_minus_y = k < 16 ? ldexpf(*cosh_y - *sinh_y, -2 * k) : 0.0f;
+        *sinh_y = ldexpf(exp_y - exp_minus_y, k - 1);
+        *cosh_y = ldexpf(exp_y + exp_minus_y, k - 1);
+    }
+}
+
+
 /*
  *  Input Range: 0 to +MAX_FLOAT
  *  Output Range: 0.5 to 2
@@ -124,7 +104,7 @@ static inline float sqrt_range_extension_in(float x, int *exponent_even){
 
 // Inverse of sqrt_range_extension_in()
 static inline float sqrt_range_extension_out(float y, int *exponent_even){
-    return ldexpf(y, *exponent_even * 0.5);
+    return ldexpf(y, *exponent_even / 2);
 }
 
 
@@ -0,0 +1,109 @@
+#include <stdint.h>
+#include <defs.h>
+#include <mram.h>
+#include "_stream.c"
+
+#ifndef RESIDENT_DPU
+#define RESIDENT_DPU
+
+/*
+ * Resident DPU program: the program is loaded and the tables are broadcast once, and then serves any number of batches
+ *
+ * For each launch, the host writes a list of commands (function, input and output offset, number of elements) into WRAM
+ * and the inputs into resident_buffer (see host/_resident_host.c). resident_serve() works through the list and returns,
+ * everything else (tables, table parameters, the program itself) stays on the DPU for the next launch.
+ *
+ * A DPU can not be written by the host while it is running, so instead of polling a command word in a loop,
+ * the program returns after each list of commands and is started again for the next one. A launch of a loaded program
+ * is cheap compared to dpu_load() and broadcast_tables(), and many small batches can be sent with a single launch.
+ */
+
+#ifndef RESIDENT_MAX_COMMANDS
+#define RESIDENT_MAX_COMMANDS 64 // This needs to match on CPU and DPU side!
+#endif
+
+#ifndef RESIDENT_BUFFER_BYTES
+#define RESIDENT_BUFFER_BYTES (16 << 20) // This needs to match on CPU and DPU side!
+#endif
+
+// Function ids, this needs to match on CPU and DPU side!
+#define RESIDENT_SINF 0
+#define RESIDENT_COSF 1
+#define RESIDENT_TANF 2
+#define RESIDENT_SINHF 3
+#define RESIDENT_COSHF 4
+#define RESIDENT_TANHF 5
+#define RESIDENT_EXPF 6
+#define RESIDENT_LOGF 7
+#define RESIDENT_SQRTF 8
+#define RESIDENT_CNDF 9
+#define RESIDENT_GELU 10
+#define RESIDENT_FUNCTIONS 11
+
+// This needs to match on CPU and DPU side!
+typedef struct {
+    uint32_t function;
+    uint32_t input_offset;  // In bytes from the start of resident_buffer, 8 byte aligned
+    uint32_t output_offset; // Can be the same as input_offset
+    uint32_t count;         // Number of floats
+} resident_command;
+
+typedef float (*resident_function)(float);
+
+__host resident_command resident_commands[RESIDENT_MAX_COMMANDS];
+__host uint32_t resident_nr_commands = 0;
+__host uint32_t resident_error = 0; // 1 + index of the first command with a function that is not compiled in, 0 if there is none
+
+__mram_noinit uint8_t resident_buffer[RESIDENT_BUFFER_BYTES];
+
+/*
+ * Runs all commands of this launch, to be called by every tasklet from main()
+ * functions[id] is the function for the id, NULL if the program does not offer it
+ */
+int resident_serve(const resident_function functions[RESIDENT_FUNCTIONS]) {
+    float *block = (float *) stream_tasklet_buffer();
+    stream_t stream;
+
+    if (me() == 0) {
+        resident_error = 0;
+    }
+
+    for (uint32_t c = 0; c < resident_nr_commands; c++) {
+        resident_command command = resident_commands[c];
+        resident_function function = command.function < RESIDENT_FUNCTIONS ? functions[command.function] : NULL;
+
+        if (function == NULL) {
+            if (me() == 0 && resident_error == 0) {
+                resident_error = c + 1;
+            }
+            continue;
+        }
+
+        __mram_ptr float *input = (__mram_ptr float *) (resident_buffer + command.input_offset);
+        __mram_ptr float *output = (__mram_ptr float *) (resident_buffer + command.output_offset);
+
+        for (stream_init(&stream, command.count, STREAM_BLOCK_SIZE(sizeof(float))); stream_next(&stream);) {
+            stream_read(&input[stream.start], block, sizeof(float) * stream.count);
+            for (uint32_t i = 0; i < stream.count; i++) {
+                block[i] = function(block[i]);
+            }
+            stream_write(block, &output[stream.start], sizeof(float) * stream.count);
+        }
+    }
+    return 0;
+}
+
+/*
+ * Basic Usage:
+ *
+ * #include "lut_ldexpf_interpolate.c"
+ * #include "_resident.c"
+ *
+ * const resident_function functions[RESIDENT_FUNCTIONS] = {[RESIDENT_EXPF] = expf, [RESIDENT_LOGF] = logf};
+ *
+ * int main() {
+ *     return resident_serve(functions);
+ * }
+ */
+
+#endif
@@ -0,0 +1,103 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <defs.h>
+#include <mram.h>
+
+#ifndef STREAM
+#define STREAM
+
+/*
+ * Block wise streaming of MRAM arrays through WRAM
+ *
+ * Every tasklet owns an equal share of STREAM_WRAM_BUDGET bytes of WRAM (stream_tasklet_buffer()).
+ * An array of size elements is split into blocks that fill this share, and the blocks are handed out round robin to the tasklets.
+ * Blocks are read and written with as few DMA transfers as possible (at most 2048 bytes each).
+ *
+ * DMA transfers on the DPU are synchronous for the issuing tasklet, but the pipeline keeps executing all other tasklets in the meantime.
+ * So with enough tasklets, the transfers of one tasklet are hidden behind the computation of the others,
+ * as long as the blocks are large enough that the fixed cost per transfer does not dominate.
+ */
+
+#ifndef STREAM_WRAM_BUDGET
+#define STREAM_WRAM_BUDGET 16384 // In bytes, for all tasklets together
+#endif
+
+#define STREAM_TASKLET_BYTES ((STREAM_WRAM_BUDGET / NR_TASKLETS) & ~7)
+#define STREAM_MAX_TRANSFER 2048
+
+#if STREAM_TASKLET_BYTES < 8
+#error "STREAM_WRAM_BUDGET is too small for NR_TASKLETS"
+#endif
+
+// Number of elements per block, if every element needs bytes_per_element bytes of WRAM (e.g. input and output together)
+// Always even, so that blocks of 4 byte elements start 8 byte aligned
+#define STREAM_BLOCK_SIZE(bytes_per_element) ((STREAM_TASKLET_BYTES / (bytes_per_element)) & ~1)
+
+__dma_aligned uint64_t stream_buffer[NR_TASKLETS][STREAM_TASKLET_BYTES / sizeof(uint64_t)];
+
+typedef struct {
+    uint32_t start; // First element of the current block
+    uint32_t count; // Number of elements in the current block
+    uint32_t size;
+    uint32_t block_size;
+} stream_t;
+
+static inline void *stream_tasklet_buffer() {
+    return (void *) stream_buffer[me()];
+}
+
+static inline void stream_init(stream_t *stream, uint32_t size, uint32_t block_size) {
+    stream->start = me() * block_size;
+    stream->count = 0;
+    stream->size = size;
+    stream->block_size = block_size;
+}
+
+// Moves on to the next block of this tasklet, returns false when there is none left
+static inline bool stream_next(stream_t *stream) {
+    if (stream->count > 0) {
+        stream->start += NR_TASKLETS * stream->block_size;
+    }
+    if (stream->start >= stream->size) {
+        return false;
+    }
+    stream->count = (stream->size - stream->start < stream->block_size) ? stream->size - stream->start : stream->block_size;
+    return true;
+}
+
+// Reads bytes rounded up to a multiple of 8 (both addresses need to be 8 byte aligned)
+static inline void stream_read(__mram_ptr const void *from, void *to, uint32_t bytes) {
+    bytes = (bytes + 7) & ~7;
+    for (uint32_t offset = 0; offset < bytes; offset += STREAM_MAX_TRANSFER) {
+        uint32_t transfer = (bytes - offset < STREAM_MAX_TRANSFER) ? bytes - offset : STREAM_MAX_TRANSFER;
+        mram_read((__mram_ptr const uint8_t *) from + offset, (uint8_t *) to + offset, transfer);
+    }
+}
+
+// Writes bytes (a multiple of 4), a trailing 4 bytes are written on their own, so nothing after the block gets overwritten
+static inline void stream_write(const void *from, __mram_ptr void *to, uint32_t bytes) {
+    uint32_t aligned_bytes = bytes & ~7;
+    for (uint32_t offset = 0; offset < aligned_bytes; offset += STREAM_MAX_TRANSFER) {
+        uint32_t transfer = (aligned_bytes - offset < STREAM_MAX_TRANSFER) ? aligned_bytes - offset : STREAM_MAX_TRANSFER;
+        mram_write((const uint8_t *) from + offset, (__mram_ptr uint8_t *) to + offset, transfer);
+    }
+    if (bytes & 4) {
+        *(__mram_ptr uint32_t *) ((__mram_ptr uint8_t *) to + aligned_bytes) = *(const uint32_t *) ((const uint8_t *) from + aligned_bytes);
+    }
+}
+
+/*
+ * Basic Usage:
+ *
+ * float *block = (float *) stream_tasklet_buffer();
+ * stream_t stream;
+ * for (stream_init(&stream, size, STREAM_BLOCK_SIZE(sizeof(float))); stream_next(&stream);) {
+ *     stream_read(&array[stream.start], block, stream.count * sizeof(float));
+ *     for (uint32_t i = 0; i < stream.count; i++) {
+ *         block[i] = expf(block[i]);
+ *     }
+ *     stream_write(block, &array[stream.start], stream.count * sizeof(float));
+ * }
+ */
+
+#endif
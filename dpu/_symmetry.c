@@ -0,0 +1,53 @@
+#include "_ldexpf.c"
+
+#ifndef SYMMETRY
+#define SYMMETRY
+
+/*
+ * Symmetries of functions, so that their tables only need to cover one half of the input range
+ *
+ * symmetry_fold() splits x into |x| and its sign, the table is looked up with |x| and the result is mapped back
+ * with the symmetry of the function. The host only generates the half of the table that is stored:
+ *  odd:          f(-x) = -f(x)                                      table holds f(|x|), e.g. tanh, sinh
+ *  even:         f(-x) = f(x)                                       table holds f(|x|), e.g. cosh (only needs the fold)
+ *  complement:   f(-x) = 1 - f(x)                                   table holds f(-|x|), e.g. cndf
+ *  x complement: f(x) = x * h(x) with h(-x) = 1 - h(x), so f(x) = x + f(-x)   table holds f(-|x|), e.g. gelu
+ *
+ * For the complement forms, the table holds the half that goes to 0: those entries keep their relative precision,
+ * which would be lost when subtracting them from 1 (or x) on the DPU.
+ * Folding and the odd mapping only use integer operations on the sign bit.
+ * See _symmetry_fixed.c for the same in fixed point.
+ *
+ * Basic Usage:
+ *
+ * unsigned int sign;
+ * float x_abs = symmetry_fold(x, &sign);
+ * float y = <table lookup with x_abs>;
+ * return symmetry_complement(y, sign);
+ */
+
+// Input Range: any float, returns |x| and the sign bit of x in sign
+static inline float symmetry_fold(float x, unsigned int *sign) {
+    unsigned int in_binary = * ( unsigned int * ) &x;
+    *sign = in_binary & FLOAT_SIGN_MASK;
+    in_binary &= FLOAT_EXPONENT_AND_MANTISSA_MASK;
+    return * ( float * ) &in_binary;
+}
+
+// f(-x) = -f(x), y = f(|x|)
+static inline float symmetry_odd(float y, unsigned int sign) {
+    unsigned int out_binary = (* ( unsigned int * ) &y) ^ sign;
+    return * ( float * ) &out_binary;
+}
+
+// f(-x) = 1 - f(x), y = f(-|x|)
+static inline float symmetry_complement(float y, unsigned int sign) {
+    return sign ? y : 1.0f - y;
+}
+
+// f(x) = x + f(-x), y = f(-|x|)
+static inline float symmetry_x_complement(float y, float x_abs, unsigned int sign) {
+    return sign ? y : x_abs + y;
+}
+
+#endif
@@ -0,0 +1,38 @@
+#ifndef SYMMETRY_FIXED
+#define SYMMETRY_FIXED
+
+/*
+ * Fixed point version of _symmetry.c, with FIXED_FRACTION_BITS bits after the comma
+ *
+ * negative is 0 for x >= 0 and -1 (all bits set) for x < 0, so that the odd mapping needs no branch.
+ *
+ * Basic Usage:
+ *
+ * int negative;
+ * int x_abs = symmetry_fold_fixed(x, &negative);
+ * int y = <table lookup with x_abs>;
+ * return symmetry_complement_fixed(y, negative);
+ */
+
+// Input Range: any int except INT_MIN, returns |x|
+static inline int symmetry_fold_fixed(int x, int *negative) {
+    *negative = x >> 31;
+    return (x ^ *negative) - *negative;
+}
+
+// f(-x) = -f(x), y = f(|x|)
+static inline int symmetry_odd_fixed(int y, int negative) {
+    return (y ^ negative) - negative;
+}
+
+// f(-x) = 1 - f(x), y = f(-|x|)
+static inline int symmetry_complement_fixed(int y, int negative) {
+    return negative ? y : (1 << FIXED_FRACTION_BITS) - y;
+}
+
+// f(x) = x + f(-x), y = f(-|x|)
+static inline int symmetry_x_complement_fixed(int y, int x_abs, int negative) {
+    return negative ? y : x_abs + y;
+}
+
+#endif
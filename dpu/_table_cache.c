@@ -0,0 +1,199 @@
+#include <stdint.h>
+#include <defs.h>
+#include <mram.h>
+#include <mutex.h>
+
+#ifndef WRAM_TABLE_CACHE
+#define WRAM_TABLE_CACHE
+
+/*
+ * Software managed WRAM cache for lookup tables that live in MRAM
+ *
+ * Tables that do not fit into WRAM are read element by element from MRAM, which costs one DMA per table access.
+ * With the cache enabled, every interpolating lookup (table[i] and table[i + 1]) first checks a small direct mapped
+ * cache of table tiles that is shared by all tasklets. On a miss the whole tile is fetched with a single mram_read.
+ *
+ * Enable it with -D TABLE_CACHE=1, the tile size (in table entries) and the number of tiles can be changed with
+ * -D TABLE_CACHE_TILE_SIZE=xyz and -D TABLE_CACHE_TILES=xyz (both need to be powers of two).
+ * WRAM usage is TABLE_CACHE_TILES * (TABLE_CACHE_TILE_SIZE + 2) * 4 bytes.
+ *
+ * Hits and misses are counted per table and per tasklet in table_cache_hits / table_cache_misses,
+ * the host can read them with the helpers in host/_table_cache_host.c
+ */
+
+#ifndef TABLE_CACHE
+#define TABLE_CACHE 0
+#endif
+
+#ifndef TABLE_CACHE_TILE_SIZE
+#define TABLE_CACHE_TILE_SIZE 64 // This needs to match on CPU and DPU side!
+#endif
+
+#ifndef TABLE_CACHE_TILES
+#define TABLE_CACHE_TILES 32 // This needs to match on CPU and DPU side!
+#endif
+
+#ifndef TABLE_CACHE_STATS
+#define TABLE_CACHE_STATS 1
+#endif
+
+#define TABLE_CACHE_MAX_TABLES 8 // This needs to match on CPU and DPU side!
+#define TABLE_CACHE_MAX_TASKLETS 24 // This needs to match on CPU and DPU side!
+
+// Each tile also holds the first two entries of the next tile, so that table[i + 1] never crosses a tile
+// (two entries instead of one to keep the DMA size a multiple of 8 bytes, the last tile of a table reads past its end)
+#define TABLE_CACHE_TILE_ENTRIES (TABLE_CACHE_TILE_SIZE + 2)
+
+#if TABLE_CACHE > 0
+#if (TABLE_CACHE_TILE_SIZE & (TABLE_CACHE_TILE_SIZE - 1)) != 0 || TABLE_CACHE_TILE_SIZE < 2
+#error "TABLE_CACHE_TILE_SIZE needs to be a power of two"
+#endif
+#if TABLE_CACHE_TILE_ENTRIES * 4 > 2048
+#error "TABLE_CACHE_TILE_SIZE is too large for a single DMA transfer"
+#endif
+#if (TABLE_CACHE_TILES & (TABLE_CACHE_TILES - 1)) != 0
+#error "TABLE_CACHE_TILES needs to be a power of two"
+#endif
+
+// Tags are stored + 1, so that the zero initialized (or host reset) cache is empty
+__host volatile uint32_t table_cache_tags[TABLE_CACHE_TILES];
+__dma_aligned uint32_t table_cache_data[TABLE_CACHE_TILES][TABLE_CACHE_TILE_ENTRIES];
+
+#if TABLE_CACHE_STATS > 0
+__host uint32_t table_cache_hits[TABLE_CACHE_MAX_TASKLETS][TABLE_CACHE_MAX_TABLES];
+__host uint32_t table_cache_misses[TABLE_CACHE_MAX_TASKLETS][TABLE_CACHE_MAX_TABLES];
+#endif
+
+MUTEX_INIT(table_cache_mutex);
+
+/*
+ * Returns table[index] and table[index + 1] (as raw 32 bit values)
+ *
+ * Lookups only take a lock on a miss: a tasklet filling a tile first invalidates the tag, then overwrites the data
+ * and finally sets the new tag. Readers check the tag before and after reading the data,
+ * so a tile that got replaced in between is never used.
+ * If another tasklet is already filling a tile, we do not wait for it and read directly from MRAM instead.
+ */
+static inline void table_cache_pair(__mram_ptr const uint32_t *table, uint32_t table_id, uint32_t index, uint32_t *lower, uint32_t *upper) {
+    uint32_t tile = index / TABLE_CACHE_TILE_SIZE;
+    uint32_t offset = index & (TABLE_CACHE_TILE_SIZE - 1);
+
+    // Spread the tables over the slots, so the first tiles of different tables don't evict each other
+    uint32_t slot = (tile + table_id * (TABLE_CACHE_TILES / TABLE_CACHE_MAX_TABLES + 1)) & (TABLE_CACHE_TILES - 1);
+    uint32_t tag = ((table_id << 24) | tile) + 1;
+
+    volatile uint32_t *data = table_cache_data[slot];
+
+    if (table_cache_tags[slot] == tag) {
+        *lower = data[offset];
+        *upper = data[offset + 1];
+        if (table_cache_tags[slot] == tag) {
+#if TABLE_CACHE_STATS > 0
+            table_cache_hits[me()][table_id]++;
+#endif
+            return;
+        }
+    }
+
+#if TABLE_CACHE_STATS > 0
+    table_cache_misses[me()][table_id]++;
+#endif
+
+    if (mutex_trylock(table_cache_mutex)) {
+        table_cache_tags[slot] = 0;
+        mram_read(&table[tile * TABLE_CACHE_TILE_SIZE], table_cache_data[slot], TABLE_CACHE_TILE_ENTRIES * sizeof(uint32_t));
+        table_cache_tags[slot] = tag;
+
+        // Read before unlocking, another tasklet may replace the tile right after
+        *lower = data[offset];
+        *upper = data[offset + 1];
+        mutex_unlock(table_cache_mutex);
+    } else {
+        *lower = table[index];
+        *upper = table[index + 1];
+    }
+}
+#endif
+
+/*
+ * Basic Usage:
+ *
+ * float base, next;
+ * MRAM_TABLE_PAIR(table, TABLE_ID, lower_address, base, next);
+ * return base + (next - base) * diff;
+ *
+ * Each method defines a <NAME>_TABLE_PAIR() for its tables that picks the WRAM or MRAM version
+ */
+#define WRAM_TABLE_PAIR(table, table_id, index, lower, upper) \
+    do { (lower) = (table)[index]; (upper) = (table)[(index) + 1]; } while (0)
+
+/*
+ * The helpers return raw 32 bit words: call writes them to the temporaries _first_word and _second_word,
+ * which are then copied into the (float or int) results, so the results are never written through a uint32_t pointer
+ */
+#define TABLE_WORD_PAIR(first, second, call)                          \
+    do {                                                              \
+        uint32_t _first_word, _second_word;                           \
+        call;                                                         \
+        __builtin_memcpy(&(first), &_first_word, sizeof(uint32_t));   \
+        __builtin_memcpy(&(second), &_second_word, sizeof(uint32_t)); \
+    } while (0)
+
+#if TABLE_CACHE > 0
+#define MRAM_TABLE_PAIR(table, table_id, index, lower, upper) \
+    TABLE_WORD_PAIR(lower, upper, table_cache_pair((__mram_ptr const uint32_t *) (table), table_id, index, &_first_word, &_second_word))
+#else
+#define MRAM_TABLE_PAIR(table, table_id, index, lower, upper) WRAM_TABLE_PAIR(table, table_id, index, lower, upper)
+#endif
+
+/*
+ * Interleaved tables (-D INTERLEAVED_TABLES=1, needs to be set on host and DPU side)
+ *
+ * The interpolating methods (lut_ldexpf_interpolate.c, lut_multi_interpolate.c, lut_fixed_interpolate.c) only need
+ * table[i] and the difference table[i + 1] - table[i]. With interleaving, the host stores both next to each other,
+ * so a table takes TABLE_WORDS(entries) 32 bit words and every lookup is a single aligned 8 byte mram_read,
+ * without the subtraction. Without interleaving, the same macros read the pair and subtract.
+ *
+ * Basic Usage:
+ *
+ * float base, delta;
+ * MRAM_TABLE_DELTA(table, TABLE_ID, lower_address, base, delta);
+ * return base + delta * diff;
+ */
+
+#ifndef INTERLEAVED_TABLES
+#define INTERLEAVED_TABLES 0 // This needs to match on CPU and DPU side!
+#endif
+
+#if INTERLEAVED_TABLES > 0
+#define TABLE_WORDS(entries) ((entries) << 1)
+
+// Returns table[index] and the difference to table[index + 1] (as raw 32 bit values) with one DMA
+static inline void interleaved_table_delta(__mram_ptr const uint64_t *table, uint32_t index, uint32_t *base, uint32_t *delta) {
+    __dma_aligned uint64_t entry;
+    mram_read(&table[index], &entry, sizeof(entry));
+    *base = (uint32_t) entry;
+    *delta = (uint32_t) (entry >> 32);
+}
+
+#define WRAM_TABLE_DELTA(table, table_id, index, base, delta) \
+    do { (base) = (table)[(index) << 1]; (delta) = (table)[((index) << 1) + 1]; } while (0)
+
+// With the cache, an entry never crosses a tile, as tiles start at even positions
+#if TABLE_CACHE > 0
+#define MRAM_TABLE_DELTA(table, table_id, index, base, delta) \
+    TABLE_WORD_PAIR(base, delta, table_cache_pair((__mram_ptr const uint32_t *) (table), table_id, (index) << 1, &_first_word, &_second_word))
+#else
+#define MRAM_TABLE_DELTA(table, table_id, index, base, delta) \
+    TABLE_WORD_PAIR(base, delta, interleaved_table_delta((__mram_ptr const uint64_t *) (table), index, &_first_word, &_second_word))
+#endif
+#else
+#define TABLE_WORDS(entries) (entries)
+
+#define WRAM_TABLE_DELTA(table, table_id, index, base, delta) \
+    do { WRAM_TABLE_PAIR(table, table_id, index, base, delta); (delta) -= (base); } while (0)
+#define MRAM_TABLE_DELTA(table, table_id, index, base, delta) \
+    do { MRAM_TABLE_PAIR(table, table_id, index, base, delta); (delta) -= (base); } while (0)
+#endif
+
+#endif
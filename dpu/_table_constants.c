@@ -0,0 +1,34 @@
+#ifndef TABLE_CONSTANTS_DPU
+#define TABLE_CONSTANTS_DPU
+
+/*
+ * Table parameters as compile time constants (-D TABLE_CONSTANTS=1, DPU side only)
+ *
+ * The granularity exponents and spacings of the LUT methods only depend on the table sizes and ranges, but are
+ * broadcast by the host and read from WRAM on every call, where they end up as variable shifts and float multipliers.
+ * host/table_constants.c runs the table setup of a method without a DPU and writes every parameter into a header
+ * as <NAME>_CONSTANT (e.g. EXP_GRANULARITY_EXPONENT_CONSTANT). With that header included, the methods use the constants
+ * instead of the WRAM globals, so the compiler can fold them into immediates.
+ *
+ * The host still broadcasts the parameters, so every parameter that is missing in the header is read from WRAM as before.
+ * The header needs to be generated with the same table options (PRECISION, <NAME>_PRECISION, ...) as the DPU program.
+ *
+ * Basic Usage:
+ *
+ * bin/host/table_constants bin/table_constants.h
+ * dpu-upmem-dpurte-clang ... -D TABLE_CONSTANTS=1 -I bin
+ */
+
+#ifndef TABLE_CONSTANTS
+#define TABLE_CONSTANTS 0
+#endif
+
+#ifndef TABLE_CONSTANTS_HEADER
+#define TABLE_CONSTANTS_HEADER "table_constants.h"
+#endif
+
+#if TABLE_CONSTANTS > 0
+#include TABLE_CONSTANTS_HEADER
+#endif
+
+#endif
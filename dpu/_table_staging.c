@@ -0,0 +1,102 @@
+#include <stdint.h>
+#include <defs.h>
+#include <mram.h>
+#include <barrier.h>
+#include <perfcounter.h>
+
+#ifndef TABLE_STAGING_DPU
+#define TABLE_STAGING_DPU
+
+/*
+ * Staged tables: kept in MRAM by the host, copied into WRAM by the DPU at kernel start (-D <NAME>_STORE_IN_WRAM=2)
+ *
+ * Tables stored in WRAM (<NAME>_STORE_IN_WRAM=1) are written by the host through the slow WRAM path, once per DPU.
+ * Staged tables are written to MRAM instead (one fast broadcast), and table_staging() copies them into a WRAM array
+ * at the start of the kernel: every tasklet takes every NR_TASKLETS-th chunk of TABLE_STAGING_CHUNK_BYTES bytes,
+ * so the copy is done with few, large and aligned DMAs. After that, lookups are the same as for WRAM tables.
+ *
+ * table_staging() needs to be called by all tasklets before the first lookup (it ends with a barrier), the cycles
+ * it took on tasklet 0 are stored in table_staging_cycles and can be printed with host/_table_staging_host.c.
+ * Staged tables take the same amount of WRAM as WRAM tables, plus the same amount of MRAM.
+ * Compressed tables are staged together with their block headers, if _compressed_tables.c is included before this file.
+ *
+ * Basic Usage:
+ *
+ * STAGED_TABLE(TABLE_ENTRY, table, TABLE_WORDS(1 << PRECISION), 1 << PRECISION)
+ * #define TABLE_DELTA(index, base, delta) WRAM_TABLE_DELTA(table_wram, TABLE_ID, index, base, delta)
+ *
+ * void table_staging() {
+ *     TABLE_STAGING_START();
+ *     STAGE_TABLE(table);
+ *     TABLE_STAGING_END();
+ * }
+ */
+
+#ifndef TABLE_STAGING_CHUNK_BYTES
+#define TABLE_STAGING_CHUNK_BYTES 2048 // Largest single mram_read
+#endif
+
+#if TABLE_STAGING_CHUNK_BYTES > 2048 || (TABLE_STAGING_CHUNK_BYTES & 7) != 0
+#error "TABLE_STAGING_CHUNK_BYTES needs to be a multiple of 8 and at most 2048"
+#endif
+
+__host uint32_t table_staging_cycles;
+BARRIER_INIT(table_staging_barrier, NR_TASKLETS);
+
+// Table size rounded up to a multiple of 8 bytes, so that both copies can be moved with DMAs only
+#define TABLE_STAGING_WORDS(type, words) ((((words) * sizeof(type) + 7) & ~7) / sizeof(type))
+
+#if defined COMPRESSED_TABLES_DPU && COMPRESSED_TABLES > 0
+#define TABLE_STAGING_COMPRESSED 1
+#else
+#define TABLE_STAGING_COMPRESSED 0
+#endif
+
+// MRAM table (written by the host) and its WRAM copy <table>_wram (used for lookups)
+#if TABLE_STAGING_COMPRESSED > 0
+#define STAGED_TABLE(type, table, words, entries)                            \
+    __mram_noinit type table[TABLE_STAGING_WORDS(type, words)];              \
+    __dma_aligned type table##_wram[TABLE_STAGING_WORDS(type, words)];       \
+    COMPRESSED_TABLE_BLOCKS(__mram_noinit, table, entries)                   \
+    COMPRESSED_TABLE_BLOCKS(__dma_aligned, table##_wram, entries)
+#else
+#define STAGED_TABLE(type, table, words, entries)                            \
+    __mram_noinit type table[TABLE_STAGING_WORDS(type, words)];              \
+    __dma_aligned type table##_wram[TABLE_STAGING_WORDS(type, words)];
+#endif
+
+// Copies the share of the current tasklet, bytes needs to be a multiple of 8
+static inline void table_staging_copy(__mram_ptr const void *from, void *to, uint32_t bytes) {
+    for (uint32_t offset = me() * TABLE_STAGING_CHUNK_BYTES; offset < bytes; offset += NR_TASKLETS * TABLE_STAGING_CHUNK_BYTES) {
+        uint32_t size = bytes - offset < TABLE_STAGING_CHUNK_BYTES ? bytes - offset : TABLE_STAGING_CHUNK_BYTES;
+        mram_read((__mram_ptr const uint8_t *) from + offset, (uint8_t *) to + offset, size);
+    }
+}
+
+#if TABLE_STAGING_COMPRESSED > 0
+#define STAGE_TABLE(table)                                                                              \
+    do {                                                                                                \
+        table_staging_copy(table, table##_wram, sizeof(table##_wram));                                  \
+        table_staging_copy(table##_blocks, table##_wram_blocks, sizeof(table##_wram_blocks));           \
+    } while (0)
+#else
+#define STAGE_TABLE(table) table_staging_copy(table, table##_wram, sizeof(table##_wram))
+#endif
+
+#define TABLE_STAGING_START()                         \
+    do {                                              \
+        if (me() == 0) {                              \
+            perfcounter_config(COUNT_CYCLES, true);   \
+        }                                             \
+    } while (0)
+
+// Waits until all tasklets copied their share
+#define TABLE_STAGING_END()                           \
+    do {                                              \
+        barrier_wait(&table_staging_barrier);         \
+        if (me() == 0) {                              \
+            table_staging_cycles = perfcounter_get(); \
+        }                                             \
+    } while (0)
+
+#endif
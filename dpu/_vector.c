@@ -0,0 +1,85 @@
+#include <stdint.h>
+#include <defs.h>
+#include <mram.h>
+
+#ifndef VECTOR
+#define VECTOR
+
+/*
+ * Helpers for the array versions of the transcendental functions (e.g. expf_v(in, out, n))
+ *
+ * The input is streamed through the WRAM buffer of each tasklet (see _stream.c), the function is applied in place.
+ * The blocks are distributed round robin over the tasklets, so all tasklets should call the function.
+ *
+ * in and out need to be 8 byte aligned (they may be the same array), n can be any size
+ * (for odd n, the last DMA reads 4 bytes past the end of in).
+ * WRAM usage is STREAM_WRAM_BUDGET bytes, shared with everything else that uses the stream buffer.
+ * The array versions are only compiled in with -D VECTOR_FUNCTIONS=1 (on the DPU side), so that programs that only use
+ * the scalar functions do not reserve the stream buffer.
+ */
+
+#ifndef VECTOR_FUNCTIONS
+#define VECTOR_FUNCTIONS 0
+#endif
+
+#if VECTOR_FUNCTIONS > 0
+#include "_stream.c"
+
+#define VECTOR_BLOCK_SIZE STREAM_BLOCK_SIZE(sizeof(uint32_t))
+
+/*
+ * Basic Usage:
+ *
+ * void expf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+ *     int granularity_exponent = exp_granularity_exponent; // Setup that is the same for all elements
+ *     VECTOR_LOOP(float, in, out, n, x, expf_core(x, granularity_exponent));
+ * }
+ */
+#define VECTOR_LOOP(type, in, out, n, x, expression)                                          \
+    do {                                                                                      \
+        type *_buffer = (type *) stream_tasklet_buffer();                                     \
+        stream_t _stream;                                                                     \
+        for (stream_init(&_stream, (n), VECTOR_BLOCK_SIZE); stream_next(&_stream);) {         \
+            stream_read(&(in)[_stream.start], _buffer, _stream.count * sizeof(type));         \
+            for (uint32_t _i = 0; _i < _stream.count; _i++) {                                 \
+                type x = _buffer[_i];                                                         \
+                _buffer[_i] = (expression);                                                   \
+            }                                                                                 \
+            stream_write(_buffer, &(out)[_stream.start], _stream.count * sizeof(type));       \
+        }                                                                                     \
+    } while (0)
+
+/*
+ * For functions with two results (e.g. sincosf_v(in, out_sin, out_cos, n)), the buffer is split in two halves:
+ * the first one holds the input and the first result, the second one the second result.
+ * first and second are pointers to the two results of the element x.
+ *
+ * Basic Usage:
+ *
+ * void sincosf_v(__mram_ptr const float *in, __mram_ptr float *out_sin, __mram_ptr float *out_cos, uint32_t n) {
+ *     VECTOR_LOOP_PAIR(float, in, out_sin, out_cos, n, x, sin_y, cos_y, sincosf_core(x, sin_y, cos_y));
+ * }
+ */
+#define VECTOR_PAIR_BLOCK_SIZE STREAM_BLOCK_SIZE(2 * sizeof(uint32_t))
+
+#define VECTOR_LOOP_PAIR(type, in, out_first, out_second, n, x, first, second, statement)     \
+    do {                                                                                      \
+        type *_buffer = (type *) stream_tasklet_buffer();                                     \
+        type *_second_buffer = _buffer + VECTOR_PAIR_BLOCK_SIZE;                              \
+        stream_t _stream;                                                                     \
+        for (stream_init(&_stream, (n), VECTOR_PAIR_BLOCK_SIZE); stream_next(&_stream);) {    \
+            stream_read(&(in)[_stream.start], _buffer, _stream.count * sizeof(type));         \
+            for (uint32_t _i = 0; _i < _stream.count; _i++) {                                 \
+                type x = _buffer[_i];                                                         \
+                type *first = &_buffer[_i];                                                   \
+                type *second = &_second_buffer[_i];                                           \
+                statement;                                                                    \
+            }                                                                                 \
+            stream_write(_buffer, &(out_first)[_stream.start], _stream.count * sizeof(type)); \
+            stream_write(_second_buffer, &(out_second)[_stream.start], _stream.count * sizeof(type)); \
+        }                                                                                     \
+    } while (0)
+
+#endif
+
+#endif
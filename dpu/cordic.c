@@ -1,5 +1,6 @@
 #include "_range_extensions.c"
 #include "_quadrants.c"
+#include "_vector.c"
 
 #ifndef PRECISION
 #define PRECISION 22
@@ -154,6 +155,12 @@ float sinf(float angle) {
     return sin_out(sin, &quadrant);
 }
 
+#if VECTOR_FUNCTIONS > 0
+void sinf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    VECTOR_LOOP(float, in, out, n, x, sinf(x));
+}
+#endif
+
 
 float cosf(float angle) {
     int cos, sin, z_cordic, quadrant;
@@ -162,6 +169,12 @@ float cosf(float angle) {
     return cos_out(cos, &quadrant);
 }
 
+#if VECTOR_FUNCTIONS > 0
+void cosf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    VECTOR_LOOP(float, in, out, n, x, cosf(x));
+}
+#endif
+
 float tanf(float angle) {
     int cos, sin, z_cordic, quadrant;
     int angle_int = sin_cos_tan_in(angle, &quadrant);
@@ -169,24 +182,77 @@ float tanf(float angle) {
     return tan_out(cos, sin, &quadrant);
 }
 
+#if VECTOR_FUNCTIONS > 0
+void tanf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    VECTOR_LOOP(float, in, out, n, x, tanf(x));
+}
+#endif
+
+// sin and cos of the same input, with only one rotation
+void sincosf(float angle, float *sin_ret, float *cos_ret) {
+    int cos, sin, z_cordic, quadrant;
+    int angle_int = sin_cos_tan_in(angle, &quadrant);
+    cordic(cordic_x_init_circular, 0, -angle_int, CIRCULAR_ROTATION, PRECISION, &cos, &sin, &z_cordic);
+    *sin_ret = sin_out(sin, &quadrant);
+    *cos_ret = cos_out(cos, &quadrant);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void sincosf_v(__mram_ptr const float *in, __mram_ptr float *out_sin, __mram_ptr float *out_cos, uint32_t n) {
+    VECTOR_LOOP_PAIR(float, in, out_sin, out_cos, n, x, sin_y, cos_y, sincosf(x, sin_y, cos_y));
+}
+#endif
+
 float coshf(float x) {
     int sinh, cosh, z_cordic;
     cordic(cordic_x_init_hyperbolic, 0, floating_to_fixed(x), HYPERBOLIC_ROTATION, PRECISION, &cosh, &sinh, &z_cordic);
     return fixed_to_floating(cosh);
 }
 
+#if VECTOR_FUNCTIONS > 0
+void coshf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    VECTOR_LOOP(float, in, out, n, x, coshf(x));
+}
+#endif
+
 float sinhf(float x) {
     int sinh, cosh, z_cordic;
     cordic(cordic_x_init_hyperbolic, 0, floating_to_fixed(x), HYPERBOLIC_ROTATION, PRECISION, &cosh, &sinh, &z_cordic);
     return fixed_to_floating(sinh);
 }
 
+#if VECTOR_FUNCTIONS > 0
+void sinhf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    VECTOR_LOOP(float, in, out, n, x, sinhf(x));
+}
+#endif
+
 float tanhf(float x) {
     int sinh, cosh, z_cordic;
     cordic(cordic_x_init_hyperbolic, 0, floating_to_fixed(x), HYPERBOLIC_ROTATION, PRECISION, &cosh, &sinh, &z_cordic);
     return (float) sinh / (float) cosh;  // Todo: Think about replacing this division
 }
 
+#if VECTOR_FUNCTIONS > 0
+void tanhf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    VECTOR_LOOP(float, in, out, n, x, tanhf(x));
+}
+#endif
+
+// sinh and cosh of the same input, with only one rotation
+void sinhcoshf(float x, float *sinh_ret, float *cosh_ret) {
+    int sinh, cosh, z_cordic;
+    cordic(cordic_x_init_hyperbolic, 0, floating_to_fixed(x), HYPERBOLIC_ROTATION, PRECISION, &cosh, &sinh, &z_cordic);
+    *sinh_ret = fixed_to_floating(sinh);
+    *cosh_ret = fixed_to_floating(cosh);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void sinhcoshf_v(__mram_ptr const float *in, __mram_ptr float *out_sinh, __mram_ptr float *out_cosh, uint32_t n) {
+    VECTOR_LOOP_PAIR(float, in, out_sinh, out_cosh, n, x, sinh_y, cosh_y, sinhcoshf(x, sinh_y, cosh_y));
+}
+#endif
+
 float expf(float x) {
     int sinh, cosh, z_cordic;
 #ifdef NOWRAP
@@ -199,6 +265,12 @@ float expf(float x) {
 #endif
 }
 
+#if VECTOR_FUNCTIONS > 0
+void expf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    VECTOR_LOOP(float, in, out, n, x, expf(x));
+}
+#endif
+
 float logf(float x) {
     int x_cordic, y_cordic, z_cordic;
 #ifdef NOWRAP
@@ -213,6 +285,12 @@ float logf(float x) {
 #endif
 }
 
+#if VECTOR_FUNCTIONS > 0
+void logf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    VECTOR_LOOP(float, in, out, n, x, logf(x));
+}
+#endif
+
 float sqrtf(float x) {
     int x_cordic, y_cordic, z_cordic;
 #ifdef NOWRAP
@@ -227,3 +305,9 @@ float sqrtf(float x) {
 #endif
 }
 
+#if VECTOR_FUNCTIONS > 0
+void sqrtf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    VECTOR_LOOP(float, in, out, n, x, sqrtf(x));
+}
+#endif
+
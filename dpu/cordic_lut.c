@@ -1,6 +1,7 @@
 #include <stdio.h>
 #include "_range_extensions.c"
 #include "_quadrants.c"
+#include "_vector.c"
 
 #pragma ide diagnostic ignored "UnusedLocalVariable"
 
@@ -127,6 +128,12 @@ float sinf(float angle) {
     return sin_out(sin, &quadrant);
 }
 
+#if VECTOR_FUNCTIONS > 0
+void sinf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    VECTOR_LOOP(float, in, out, n, x, sinf(x));
+}
+#endif
+
 
 float cosf(float angle) {
     int cos, sin, z_cordic, quadrant;
@@ -135,6 +142,12 @@ float cosf(float angle) {
     return cos_out(cos, &quadrant);
 }
 
+#if VECTOR_FUNCTIONS > 0
+void cosf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    VECTOR_LOOP(float, in, out, n, x, cosf(x));
+}
+#endif
+
 float tanf(float angle) {
     int cos, sin, z_cordic, quadrant;
     int angle_int = sin_cos_tan_in(angle, &quadrant);
@@ -142,6 +155,27 @@ float tanf(float angle) {
     return tan_out(cos, sin, &quadrant);
 }
 
+#if VECTOR_FUNCTIONS > 0
+void tanf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    VECTOR_LOOP(float, in, out, n, x, tanf(x));
+}
+#endif
+
+// sin and cos of the same input, with only one rotation
+void sincosf(float angle, float *sin_ret, float *cos_ret) {
+    int cos, sin, z_cordic, quadrant;
+    int angle_int = sin_cos_tan_in(angle, &quadrant);
+    cordic(-angle_int, CIRCULAR_ROTATION, PRECISION, &cos, &sin, &z_cordic);
+    *sin_ret = sin_out(sin, &quadrant);
+    *cos_ret = cos_out(cos, &quadrant);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void sincosf_v(__mram_ptr const float *in, __mram_ptr float *out_sin, __mram_ptr float *out_cos, uint32_t n) {
+    VECTOR_LOOP_PAIR(float, in, out_sin, out_cos, n, x, sin_y, cos_y, sincosf(x, sin_y, cos_y));
+}
+#endif
+
 
 float coshf(float x) {
     int sinh, cosh, z_cordic;
@@ -149,18 +183,50 @@ float coshf(float x) {
     return fixed_to_floating(cosh);
 }
 
+#if VECTOR_FUNCTIONS > 0
+void coshf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    VECTOR_LOOP(float, in, out, n, x, coshf(x));
+}
+#endif
+
 float sinhf(float x) {
     int sinh, cosh, z_cordic;
     cordic(floating_to_fixed(x), HYPERBOLIC_ROTATION, PRECISION, &cosh, &sinh, &z_cordic);
     return fixed_to_floating(sinh);
 }
 
+#if VECTOR_FUNCTIONS > 0
+void sinhf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    VECTOR_LOOP(float, in, out, n, x, sinhf(x));
+}
+#endif
+
 float tanhf(float x) {
     int sinh, cosh, z_cordic;
     cordic(floating_to_fixed(x), HYPERBOLIC_ROTATION, PRECISION, &cosh, &sinh, &z_cordic);
     return (float) sinh / (float) cosh;
 }
 
+#if VECTOR_FUNCTIONS > 0
+void tanhf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    VECTOR_LOOP(float, in, out, n, x, tanhf(x));
+}
+#endif
+
+// sinh and cosh of the same input, with only one rotation
+void sinhcoshf(float x, float *sinh_ret, float *cosh_ret) {
+    int sinh, cosh, z_cordic;
+    cordic(floating_to_fixed(x), HYPERBOLIC_ROTATION, PRECISION, &cosh, &sinh, &z_cordic);
+    *sinh_ret = fixed_to_floating(sinh);
+    *cosh_ret = fixed_to_floating(cosh);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void sinhcoshf_v(__mram_ptr const float *in, __mram_ptr float *out_sinh, __mram_ptr float *out_cosh, uint32_t n) {
+    VECTOR_LOOP_PAIR(float, in, out_sinh, out_cosh, n, x, sinh_y, cosh_y, sinhcoshf(x, sinh_y, cosh_y));
+}
+#endif
+
 float expf(float x) {
     int sinh, cosh, z_cordic;
 #ifdef NOWRAP
@@ -171,4 +237,10 @@ float expf(float x) {
     cordic(floating_to_fixed(exp_range_extension_in(x, &shift)), HYPERBOLIC_ROTATION, PRECISION, &cosh, &sinh, &z_cordic);
     return exp_range_extension_out(fixed_to_floating(sinh + cosh), &shift);
 #endif
-}
\ No newline at end of file
+}
+
+#if VECTOR_FUNCTIONS > 0
+void expf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    VECTOR_LOOP(float, in, out, n, x, expf(x));
+}
+#endif
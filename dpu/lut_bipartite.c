@@ -0,0 +1,410 @@
+#include "_ldexpf.c"
+#include "_quadrants.c"
+#include "_packed_tables.c"
+#include "_vector.c"
+#include "_table_constants.c"
+
+#pragma ide diagnostic ignored "UnusedParameter"
+#pragma ide diagnostic ignored "UnusedLocalVariable"
+#pragma ide diagnostic ignored "UnusedValue"
+
+/*
+ * Bipartite LUT: f(x) = initial_values[x0 x1] + offsets[x0 x2], with no multiplication at all
+ *
+ * The reduced input is cut into a PRECISION bit address, which is split into x0 (high), x1 (middle) and x2 (low bits).
+ * The table of initial values has the function at the centre of every (x0, x1) block,
+ * the table of offsets adds the change within a block for the low bits, which mostly depends on x0 alone (the slope).
+ * So the result is as good as a non-interpolated table with 2^PRECISION entries,
+ * but the two tables only have 2^(PRECISION - PRECISION / 3) and 2^(2 * (PRECISION / 3)) entries.
+ *
+ * Compared to lut_ldexpf_interpolate.c, base + (next - base) * diff becomes a single float addition,
+ * which matters on DPUs without floating point hardware. The tables are small, so they are in WRAM by default.
+ * The tables are generated on the host side (see host/lut_bipartite_host.c).
+ */
+
+#ifndef PRECISION
+#define PRECISION 14 // This needs to match on CPU and DPU side!
+#endif
+
+// Functions that are compiled in (single ones can be switched with <NAME>_ENABLED)
+#ifndef ALL_FUNCTIONS_ENABLED
+#define ALL_FUNCTIONS_ENABLED 1 // This needs to match on CPU and DPU side!
+#endif
+
+// Split of an address with p bits, x0 and x2 both have BIPARTITE_OUTER_BITS(p), this needs to match on CPU and DPU side!
+#define BIPARTITE_OUTER_BITS(p) ((p) / 3)
+#define BIPARTITE_INITIAL_VALUES(p) (1 << ((p) - BIPARTITE_OUTER_BITS(p)))
+#define BIPARTITE_OFFSETS(p) (1 << (2 * BIPARTITE_OUTER_BITS(p)))
+
+/******************************************************************************************************************
+ * Basic Usage of Helper Functions:
+ *
+ * unsigned int address = float_to_address_bipartite(x, table_exponent, table_lower_address);
+ * return BIPARTITE_LOOKUP(initial_value_table, offset_table, address, TABLE_PRECISION);
+ */
+
+//Helper Function: address of x in a table starting at lower_address * 2^exponent
+static inline unsigned int float_to_address_bipartite(float x, int exponent, int lower_address) {
+    return (unsigned int) ldexpf(x, - exponent) - lower_address;
+}
+
+//Helper Function
+static inline unsigned int fixed_to_address_bipartite(unsigned int x, int exponent) {
+    return x >> (FIXED_FRACTION_BITS + exponent);
+}
+
+#define BIPARTITE_LOOKUP(initial_values, offsets, address, p) \
+    ((initial_values)[(address) >> BIPARTITE_OUTER_BITS(p)] \
+     + (offsets)[((address) >> ((p) - BIPARTITE_OUTER_BITS(p)) << BIPARTITE_OUTER_BITS(p)) | ((address) & ((1 << BIPARTITE_OUTER_BITS(p)) - 1))])
+
+
+/***********************************************************
+*   SIN / COS / TAN
+*/
+
+#ifndef SIN_COS_TAN_ENABLED
+#define SIN_COS_TAN_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if SIN_COS_TAN_ENABLED > 0
+
+// Address generation function parameters
+#ifndef SIN_COS_TAN_PRECISION
+#define SIN_COS_TAN_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
+
+// Storage
+#ifndef SIN_COS_TAN_STORE_IN_WRAM
+#define SIN_COS_TAN_STORE_IN_WRAM 1
+#endif
+
+#define SIN_COS_TAN_TABLE_ID 0
+#define SIN_COS_TAN_OFFSET_TABLE_ID 1
+#if PACKED_TABLES > 0
+#define sin_cos_tan_granularity_exponent PACKED_INT_PARAMETER(SIN_COS_TAN_TABLE_ID)
+#else
+__host int sin_cos_tan_granularity_exponent;
+#endif
+#ifdef SIN_COS_TAN_GRANULARITY_EXPONENT_CONSTANT
+#undef sin_cos_tan_granularity_exponent
+#define sin_cos_tan_granularity_exponent SIN_COS_TAN_GRANULARITY_EXPONENT_CONSTANT
+#endif
+
+#if SIN_COS_TAN_STORE_IN_WRAM > 0 && PACKED_TABLES == 0
+__host float sin_cos_tan_table[BIPARTITE_INITIAL_VALUES(SIN_COS_TAN_PRECISION)];
+__host float sin_cos_tan_offset_table[BIPARTITE_OFFSETS(SIN_COS_TAN_PRECISION)];
+#elif PACKED_TABLES > 0
+#define sin_cos_tan_table PACKED_TABLE(float, SIN_COS_TAN_TABLE_ID)
+#define sin_cos_tan_offset_table PACKED_TABLE(float, SIN_COS_TAN_OFFSET_TABLE_ID)
+#else
+__mram_noinit float sin_cos_tan_table[BIPARTITE_INITIAL_VALUES(SIN_COS_TAN_PRECISION)];
+__mram_noinit float sin_cos_tan_offset_table[BIPARTITE_OFFSETS(SIN_COS_TAN_PRECISION)];
+#endif
+
+// Functions
+static inline float sinf_core(float x, int granularity_exponent) {
+    int quadrant;
+    unsigned int address = fixed_to_address_bipartite(sin_cos_tan_in(x, &quadrant), granularity_exponent);
+    float y = BIPARTITE_LOOKUP(sin_cos_tan_table, sin_cos_tan_offset_table, address, SIN_COS_TAN_PRECISION);
+    return sin_float_out(y, &quadrant);
+}
+
+float sinf(float x) {
+    return sinf_core(x, sin_cos_tan_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void sinf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    int granularity_exponent = sin_cos_tan_granularity_exponent;
+    VECTOR_LOOP(float, in, out, n, x, sinf_core(x, granularity_exponent));
+}
+#endif
+
+static inline float cosf_core(float x, int granularity_exponent) {
+    int quadrant;
+    unsigned int address = fixed_to_address_bipartite(cos_to_sin_in(x, &quadrant), granularity_exponent);
+    float y = BIPARTITE_LOOKUP(sin_cos_tan_table, sin_cos_tan_offset_table, address, SIN_COS_TAN_PRECISION);
+    return sin_float_out(y, &quadrant);
+}
+
+float cosf(float x) {
+    return cosf_core(x, sin_cos_tan_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void cosf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    int granularity_exponent = sin_cos_tan_granularity_exponent;
+    VECTOR_LOOP(float, in, out, n, x, cosf_core(x, granularity_exponent));
+}
+#endif
+
+static inline float tanf_core(float x, int granularity_exponent) {
+    int quadrant;
+    int x_fixed_point = sin_cos_tan_in(x, &quadrant);
+    unsigned int cos_address = fixed_to_address_bipartite(sin_to_cos_in(x_fixed_point), granularity_exponent);
+    unsigned int sin_address = fixed_to_address_bipartite(x_fixed_point, granularity_exponent);
+
+    float cos_y = BIPARTITE_LOOKUP(sin_cos_tan_table, sin_cos_tan_offset_table, cos_address, SIN_COS_TAN_PRECISION);
+    float sin_y = BIPARTITE_LOOKUP(sin_cos_tan_table, sin_cos_tan_offset_table, sin_address, SIN_COS_TAN_PRECISION);
+    return tan_float_out(cos_y, sin_y, &quadrant);
+}
+
+float tanf(float x) {
+    return tanf_core(x, sin_cos_tan_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void tanf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    int granularity_exponent = sin_cos_tan_granularity_exponent;
+    VECTOR_LOOP(float, in, out, n, x, tanf_core(x, granularity_exponent));
+}
+#endif
+
+// sin and cos of the same input, with only one range reduction
+static inline void sincosf_core(float x, int granularity_exponent, float *sin_ret, float *cos_ret) {
+    int quadrant;
+    int x_fixed_point = sin_cos_tan_in(x, &quadrant);
+    unsigned int sin_address = fixed_to_address_bipartite(x_fixed_point, granularity_exponent);
+    unsigned int cos_address = fixed_to_address_bipartite(sin_to_cos_in(x_fixed_point), granularity_exponent);
+
+    float sin_y = BIPARTITE_LOOKUP(sin_cos_tan_table, sin_cos_tan_offset_table, sin_address, SIN_COS_TAN_PRECISION);
+    float cos_y = BIPARTITE_LOOKUP(sin_cos_tan_table, sin_cos_tan_offset_table, cos_address, SIN_COS_TAN_PRECISION);
+    *sin_ret = sin_float_out(sin_y, &quadrant);
+    *cos_ret = cos_float_out(cos_y, &quadrant);
+}
+
+void sincosf(float x, float *sin_ret, float *cos_ret) {
+    sincosf_core(x, sin_cos_tan_granularity_exponent, sin_ret, cos_ret);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void sincosf_v(__mram_ptr const float *in, __mram_ptr float *out_sin, __mram_ptr float *out_cos, uint32_t n) {
+    int granularity_exponent = sin_cos_tan_granularity_exponent;
+    VECTOR_LOOP_PAIR(float, in, out_sin, out_cos, n, x, sin_y, cos_y, sincosf_core(x, granularity_exponent, sin_y, cos_y));
+}
+#endif
+
+#endif
+
+
+/***********************************************************
+*   EXP
+*/
+
+#ifndef EXP_ENABLED
+#define EXP_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if EXP_ENABLED > 0
+
+// Address generation function parameters
+#ifndef EXP_PRECISION
+#define EXP_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
+
+// Storage
+#ifndef EXP_STORE_IN_WRAM
+#define EXP_STORE_IN_WRAM 1
+#endif
+
+#define EXP_TABLE_ID 2
+#define EXP_OFFSET_TABLE_ID 3
+#if PACKED_TABLES > 0
+#define exp_granularity_exponent PACKED_INT_PARAMETER(EXP_TABLE_ID)
+#else
+__host int exp_granularity_exponent;
+#endif
+#ifdef EXP_GRANULARITY_EXPONENT_CONSTANT
+#undef exp_granularity_exponent
+#define exp_granularity_exponent EXP_GRANULARITY_EXPONENT_CONSTANT
+#endif
+
+#if EXP_STORE_IN_WRAM > 0 && PACKED_TABLES == 0
+__host float exp_table[BIPARTITE_INITIAL_VALUES(EXP_PRECISION)];
+__host float exp_offset_table[BIPARTITE_OFFSETS(EXP_PRECISION)];
+#elif PACKED_TABLES > 0
+#define exp_table PACKED_TABLE(float, EXP_TABLE_ID)
+#define exp_offset_table PACKED_TABLE(float, EXP_OFFSET_TABLE_ID)
+#else
+__mram_noinit float exp_table[BIPARTITE_INITIAL_VALUES(EXP_PRECISION)];
+__mram_noinit float exp_offset_table[BIPARTITE_OFFSETS(EXP_PRECISION)];
+#endif
+
+// Functions
+static inline float expf_core(float x, int granularity_exponent) {
+    #ifdef NOWRAP
+        unsigned int address = float_to_address_bipartite(x, granularity_exponent, 0);
+        return BIPARTITE_LOOKUP(exp_table, exp_offset_table, address, EXP_PRECISION);
+    #else
+        int extra_data;
+        unsigned int address = float_to_address_bipartite(exp_range_extension_in(x, &extra_data), granularity_exponent, 0);
+        return exp_range_extension_out(BIPARTITE_LOOKUP(exp_table, exp_offset_table, address, EXP_PRECISION), &extra_data);
+    #endif
+}
+
+float expf(float x) {
+    return expf_core(x, exp_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void expf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    int granularity_exponent = exp_granularity_exponent;
+    VECTOR_LOOP(float, in, out, n, x, expf_core(x, granularity_exponent));
+}
+#endif
+
+#endif
+
+
+/***********************************************************
+*   LOG
+*/
+
+#ifndef LOG_ENABLED
+#define LOG_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if LOG_ENABLED > 0
+
+// Address generation function parameters
+#ifndef LOG_PRECISION
+#define LOG_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
+
+// Storage
+#ifndef LOG_STORE_IN_WRAM
+#define LOG_STORE_IN_WRAM 1
+#endif
+
+// The table starts at the lower end of the mantissa (lower_address entries from 0)
+#define LOG_TABLE_ID 4
+#define LOG_OFFSET_TABLE_ID 5
+#if PACKED_TABLES > 0
+#define log_granularity_exponent PACKED_INT_PARAMETER(LOG_TABLE_ID)
+#define log_lower_address PACKED_INT_PARAMETER(LOG_OFFSET_TABLE_ID)
+#else
+__host int log_granularity_exponent;
+__host int log_lower_address;
+#endif
+#ifdef LOG_GRANULARITY_EXPONENT_CONSTANT
+#undef log_granularity_exponent
+#define log_granularity_exponent LOG_GRANULARITY_EXPONENT_CONSTANT
+#endif
+#ifdef LOG_LOWER_ADDRESS_CONSTANT
+#undef log_lower_address
+#define log_lower_address LOG_LOWER_ADDRESS_CONSTANT
+#endif
+
+#if LOG_STORE_IN_WRAM > 0 && PACKED_TABLES == 0
+__host float log_table[BIPARTITE_INITIAL_VALUES(LOG_PRECISION)];
+__host float log_offset_table[BIPARTITE_OFFSETS(LOG_PRECISION)];
+#elif PACKED_TABLES > 0
+#define log_table PACKED_TABLE(float, LOG_TABLE_ID)
+#define log_offset_table PACKED_TABLE(float, LOG_OFFSET_TABLE_ID)
+#else
+__mram_noinit float log_table[BIPARTITE_INITIAL_VALUES(LOG_PRECISION)];
+__mram_noinit float log_offset_table[BIPARTITE_OFFSETS(LOG_PRECISION)];
+#endif
+
+// Function
+static inline float logf_core(float x, int granularity_exponent, int lower_address) {
+    #ifdef NOWRAP
+        unsigned int address = float_to_address_bipartite(x, granularity_exponent, lower_address);
+        return BIPARTITE_LOOKUP(log_table, log_offset_table, address, LOG_PRECISION);
+    #else
+        int extra_data;
+        unsigned int address = float_to_address_bipartite(log_range_extension_in(x, &extra_data), granularity_exponent, lower_address);
+        return log_range_extension_out(BIPARTITE_LOOKUP(log_table, log_offset_table, address, LOG_PRECISION), &extra_data);
+    #endif
+}
+
+float logf(float x) {
+    return logf_core(x, log_granularity_exponent, log_lower_address);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void logf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    int granularity_exponent = log_granularity_exponent;
+    int lower_address = log_lower_address;
+    VECTOR_LOOP(float, in, out, n, x, logf_core(x, granularity_exponent, lower_address));
+}
+#endif
+
+#endif
+
+
+/***********************************************************
+*   SQRT
+*/
+
+#ifndef SQRT_ENABLED
+#define SQRT_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if SQRT_ENABLED > 0
+
+// Address generation function parameters
+#ifndef SQRT_PRECISION
+#define SQRT_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
+
+// Storage
+#ifndef SQRT_STORE_IN_WRAM
+#define SQRT_STORE_IN_WRAM 1
+#endif
+
+// The table starts at the lower end of the mantissa (lower_address entries from 0)
+#define SQRT_TABLE_ID 6
+#define SQRT_OFFSET_TABLE_ID 7
+#if PACKED_TABLES > 0
+#define sqrt_granularity_exponent PACKED_INT_PARAMETER(SQRT_TABLE_ID)
+#define sqrt_lower_address PACKED_INT_PARAMETER(SQRT_OFFSET_TABLE_ID)
+#else
+__host int sqrt_granularity_exponent;
+__host int sqrt_lower_address;
+#endif
+#ifdef SQRT_GRANULARITY_EXPONENT_CONSTANT
+#undef sqrt_granularity_exponent
+#define sqrt_granularity_exponent SQRT_GRANULARITY_EXPONENT_CONSTANT
+#endif
+#ifdef SQRT_LOWER_ADDRESS_CONSTANT
+#undef sqrt_lower_address
+#define sqrt_lower_address SQRT_LOWER_ADDRESS_CONSTANT
+#endif
+
+#if SQRT_STORE_IN_WRAM > 0 && PACKED_TABLES == 0
+__host float sqrt_table[BIPARTITE_INITIAL_VALUES(SQRT_PRECISION)];
+__host float sqrt_offset_table[BIPARTITE_OFFSETS(SQRT_PRECISION)];
+#elif PACKED_TABLES > 0
+#define sqrt_table PACKED_TABLE(float, SQRT_TABLE_ID)
+#define sqrt_offset_table PACKED_TABLE(float, SQRT_OFFSET_TABLE_ID)
+#else
+__mram_noinit float sqrt_table[BIPARTITE_INITIAL_VALUES(SQRT_PRECISION)];
+__mram_noinit float sqrt_offset_table[BIPARTITE_OFFSETS(SQRT_PRECISION)];
+#endif
+
+// Function
+static inline float sqrtf_core(float x, int granularity_exponent, int lower_address) {
+    #ifdef NOWRAP
+        unsigned int address = float_to_address_bipartite(x, granularity_exponent, lower_address);
+        return BIPARTITE_LOOKUP(sqrt_table, sqrt_offset_table, address, SQRT_PRECISION);
+    #else
+        int extra_data;
+        unsigned int address = float_to_address_bipartite(sqrt_range_extension_in(x, &extra_data), granularity_exponent, lower_address);
+        return sqrt_range_extension_out(BIPARTITE_LOOKUP(sqrt_table, sqrt_offset_table, address, SQRT_PRECISION), &extra_data);
+    #endif
+}
+
+float sqrtf(float x) {
+    return sqrtf_core(x, sqrt_granularity_exponent, sqrt_lower_address);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void sqrtf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    int granularity_exponent = sqrt_granularity_exponent;
+    int lower_address = sqrt_lower_address;
+    VECTOR_LOOP(float, in, out, n, x, sqrtf_core(x, granularity_exponent, lower_address));
+}
+#endif
+
+#endif
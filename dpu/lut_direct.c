@@ -1,11 +1,20 @@
 #include <stdio.h>
 #include "_ldexpf.c"
 #include "_quadrants.c"
+#include "_symmetry.c"
+#include "_table_cache.c"
+#include "_packed_tables.c"
+#include "_vector.c"
 
 #ifndef PRECISION
 #define PRECISION 10 // This needs to match on CPU and DPU side!
 #endif
 
+// Functions that are compiled in (single ones can be switched with <NAME>_ENABLED)
+#ifndef ALL_FUNCTIONS_ENABLED
+#define ALL_FUNCTIONS_ENABLED 1 // This needs to match on CPU and DPU side!
+#endif
+
 // Values needed to support different float sizes
 #define FLOAT_MANTISSA_BITS 23
 #define FLOAT_EXPONENT_MAKS 0xFF
@@ -54,13 +63,34 @@ float float_to_diff(float x, unsigned int in, int precision, int mantissa_size,
 }
 
 
+// Helper Macro
+// Reads the two table entries around address, address -1 stands for the interval between 0 and table[0]
+#define DIRECT_TABLE_PAIR(TABLE_PAIR, address, lower, upper) \
+    do {                                                        \
+        if ((address) >= 0) {                                   \
+            TABLE_PAIR(address, lower, upper);                  \
+        } else {                                                \
+            TABLE_PAIR(0, upper, lower);                        \
+            (lower) = 0.0f;                                     \
+        }                                                       \
+    } while (0)
+
+
 /***********************************************************
 *   TANH
 */
 
+#ifndef TANH_ENABLED
+#define TANH_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if TANH_ENABLED > 0
+
 // Address generation function parameters
+#ifndef TANH_PRECISION
 #define TANH_PRECISION PRECISION // This needs to match on CPU and DPU side!
-#define TANH_MANTISSA_SIZE (PRECISION - 3) // This needs to match on CPU and DPU side!
+#endif
+#define TANH_MANTISSA_SIZE (TANH_PRECISION - 3) // This needs to match on CPU and DPU side!
 #define TANH_MIN_EXPONENT -4 // This needs to match on CPU and DPU side!
 
 // Storage
@@ -68,33 +98,53 @@ float float_to_diff(float x, unsigned int in, int precision, int mantissa_size,
 #define TANH_STORE_IN_WRAM 0
 #endif
 
-#if TANH_STORE_IN_WRAM > 0
+#define TANH_TABLE_ID 0
+#if TANH_STORE_IN_WRAM > 0 && PACKED_TABLES == 0
 __host float tanh_table[1 << TANH_PRECISION];
+#define TANH_TABLE_PAIR(index, lower, upper) WRAM_TABLE_PAIR(tanh_table, TANH_TABLE_ID, index, lower, upper)
+#else
+#if PACKED_TABLES > 0
+#define tanh_table PACKED_TABLE(float, TANH_TABLE_ID)
 #else
 __mram_noinit float tanh_table[1 << TANH_PRECISION];
 #endif
+#define TANH_TABLE_PAIR(index, lower, upper) MRAM_TABLE_PAIR(tanh_table, TANH_TABLE_ID, index, lower, upper)
+#endif
 
 // Function
 float tanhf(float x) {
-    if (x >= 0) {
-        int address = float_to_address(x, TANH_PRECISION, TANH_MANTISSA_SIZE, TANH_MIN_EXPONENT);
-        float base = (address >= 0) ? tanh_table[address]: 0.0f;
-        return base + (tanh_table[address + 1] - base) * float_to_diff(x, address, TANH_PRECISION, TANH_MANTISSA_SIZE, TANH_MIN_EXPONENT);
-    } else {
-        int address = float_to_address(-x, TANH_PRECISION, TANH_MANTISSA_SIZE, TANH_MIN_EXPONENT);
-        float base = (address >= 0) ? tanh_table[address]: 0.0f;
-        return - base - (tanh_table[address + 1] - base) * float_to_diff(-x, address, TANH_PRECISION, TANH_MANTISSA_SIZE, TANH_MIN_EXPONENT);
-    }
+    unsigned int sign;
+    float x_abs = symmetry_fold(x, &sign);
+    int address = float_to_address(x_abs, TANH_PRECISION, TANH_MANTISSA_SIZE, TANH_MIN_EXPONENT);
+    float base, next;
+    DIRECT_TABLE_PAIR(TANH_TABLE_PAIR, address, base, next);
+    return symmetry_odd(base + (next - base) * float_to_diff(x_abs, address, TANH_PRECISION, TANH_MANTISSA_SIZE, TANH_MIN_EXPONENT), sign);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void tanhf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    VECTOR_LOOP(float, in, out, n, x, tanhf(x));
 }
+#endif
+
+#endif
 
 
 /***********************************************************
 *   GELU
 */
 
+#ifndef GELU_ENABLED
+#define GELU_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if GELU_ENABLED > 0
+
 // Address generation function parameters
+#ifndef GELU_PRECISION
 #define GELU_PRECISION (PRECISION - 1) // This needs to match on CPU and DPU side!
-#define GELU_MANTISSA_SIZE (PRECISION - 4) // This needs to match on CPU and DPU side!
+#endif
+#define GELU_MANTISSA_SIZE (GELU_PRECISION - 3) // This needs to match on CPU and DPU side!
 #define GELU_MIN_EXPONENT -4 // This needs to match on CPU and DPU side!
 
 // Storage
@@ -102,37 +152,57 @@ float tanhf(float x) {
 #define GELU_STORE_IN_WRAM 0
 #endif
 
-#if GELU_STORE_IN_WRAM > 0
-__host float gelu_table_p[1 << GELU_PRECISION];
-__host float gelu_table_n[1 << GELU_PRECISION];
+// The table holds gelu(-x) for x >= 0, gelu(x) is x + gelu(-x) (see _symmetry.c)
+#define GELU_TABLE_ID 1
+#if GELU_STORE_IN_WRAM > 0 && PACKED_TABLES == 0
+__host float gelu_table[1 << GELU_PRECISION];
+#define GELU_TABLE_PAIR(index, lower, upper) WRAM_TABLE_PAIR(gelu_table, GELU_TABLE_ID, index, lower, upper)
 #else
-__mram_noinit float gelu_table_p[1 << GELU_PRECISION];
-__mram_noinit float gelu_table_n[1 << GELU_PRECISION];
+#if PACKED_TABLES > 0
+#define gelu_table PACKED_TABLE(float, GELU_TABLE_ID)
+#else
+__mram_noinit float gelu_table[1 << GELU_PRECISION];
+#endif
+#define GELU_TABLE_PAIR(index, lower, upper) MRAM_TABLE_PAIR(gelu_table, GELU_TABLE_ID, index, lower, upper)
 #endif
 
 // Function
 float gelu(float x) {
-    if (x > 0) {
-        int address = float_to_address(x, GELU_PRECISION, GELU_MANTISSA_SIZE,GELU_MIN_EXPONENT);
-        float base = (address >= 0) ? gelu_table_p[address]: 0.0f;
-        if (address == (1 << GELU_PRECISION) - 1) {
-            return x;
-        }
-        return base + (gelu_table_p[address + 1] - base) * float_to_diff(x, address,  GELU_PRECISION, GELU_MANTISSA_SIZE, GELU_MIN_EXPONENT);
-    } else {
-        int address = float_to_address(-x, GELU_PRECISION, GELU_MANTISSA_SIZE,GELU_MIN_EXPONENT);
-        float base = (address >= 0) ? gelu_table_n[address]: 0.0f;
-        return base + (gelu_table_n[address + 1] - base) * float_to_diff(-x, address,  GELU_PRECISION, GELU_MANTISSA_SIZE, GELU_MIN_EXPONENT);
+    unsigned int sign;
+    float x_abs = symmetry_fold(x, &sign);
+    int address = float_to_address(x_abs, GELU_PRECISION, GELU_MANTISSA_SIZE,GELU_MIN_EXPONENT);
+    if (!sign && address == (1 << GELU_PRECISION) - 1) {
+        return x;
     }
+    float base, next;
+    DIRECT_TABLE_PAIR(GELU_TABLE_PAIR, address, base, next);
+    return symmetry_x_complement(base + (next - base) * float_to_diff(x_abs, address,  GELU_PRECISION, GELU_MANTISSA_SIZE, GELU_MIN_EXPONENT), x_abs, sign);
 }
 
+#if VECTOR_FUNCTIONS > 0
+void gelu_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    VECTOR_LOOP(float, in, out, n, x, gelu(x));
+}
+#endif
+
+#endif
+
+
 /***********************************************************
 *   SIN
 */
 
+#ifndef SIN_COS_TAN_ENABLED
+#define SIN_COS_TAN_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if SIN_COS_TAN_ENABLED > 0
+
 // Address generation function parameters
+#ifndef SIN_COS_TAN_PRECISION
 #define SIN_COS_TAN_PRECISION PRECISION // This needs to match on CPU and DPU side!
-#define SIN_COS_TAN_MANTISSA_SIZE (PRECISION - 3) // This needs to match on CPU and DPU side!
+#endif
+#define SIN_COS_TAN_MANTISSA_SIZE (SIN_COS_TAN_PRECISION - 3) // This needs to match on CPU and DPU side!
 #define SIN_COS_TAN_MIN_EXPONENT -7 // This needs to match on CPU and DPU side!
 
 // Storage
@@ -140,17 +210,33 @@ float gelu(float x) {
 #define SIN_COS_TAN_STORE_IN_WRAM 0
 #endif
 
-#if SIN_COS_TAN_STORE_IN_WRAM > 0
+#define SIN_TABLE_ID 2
+#if SIN_COS_TAN_STORE_IN_WRAM > 0 && PACKED_TABLES == 0
 __host float sin_table[1 << SIN_COS_TAN_PRECISION];
+#define SIN_TABLE_PAIR(index, lower, upper) WRAM_TABLE_PAIR(sin_table, SIN_TABLE_ID, index, lower, upper)
+#else
+#if PACKED_TABLES > 0
+#define sin_table PACKED_TABLE(float, SIN_TABLE_ID)
 #else
 __mram_noinit float sin_table[1 << SIN_COS_TAN_PRECISION];
 #endif
+#define SIN_TABLE_PAIR(index, lower, upper) MRAM_TABLE_PAIR(sin_table, SIN_TABLE_ID, index, lower, upper)
+#endif
 
 // Function
 float sinf(float x) {
   int quadrant;
   float x_quadrant = sin_cos_tan_in_float(x, &quadrant);
   int address = float_to_address(x_quadrant, SIN_COS_TAN_PRECISION, SIN_COS_TAN_MANTISSA_SIZE, SIN_COS_TAN_MIN_EXPONENT);
-  float base = (address >= 0) ? sin_table[address]: 0.0f;
-  return sin_float_out(base + (sin_table[address + 1] - base) * float_to_diff(x_quadrant, address, SIN_COS_TAN_PRECISION, SIN_COS_TAN_MANTISSA_SIZE, SIN_COS_TAN_MIN_EXPONENT), &quadrant);
-}
\ No newline at end of file
+  float base, next;
+  DIRECT_TABLE_PAIR(SIN_TABLE_PAIR, address, base, next);
+  return sin_float_out(base + (next - base) * float_to_diff(x_quadrant, address, SIN_COS_TAN_PRECISION, SIN_COS_TAN_MANTISSA_SIZE, SIN_COS_TAN_MIN_EXPONENT), &quadrant);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void sinf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    VECTOR_LOOP(float, in, out, n, x, sinf(x));
+}
+#endif
+
+#endif
@@ -1,4 +1,8 @@
 #include "_quadrants_fixed.c"
+#include "_symmetry_fixed.c"
+#include "_packed_tables.c"
+#include "_vector.c"
+#include "_table_constants.c"
 
 #pragma ide diagnostic ignored "UnusedParameter"
 #pragma ide diagnostic ignored "UnusedLocalVariable"
@@ -8,6 +12,16 @@
 #define PRECISION 10 // This needs to match on CPU and DPU side!
 #endif
 
+// Functions that are compiled in (single ones can be switched with <NAME>_ENABLED)
+#ifndef ALL_FUNCTIONS_ENABLED
+#define ALL_FUNCTIONS_ENABLED 1 // This needs to match on CPU and DPU side!
+#endif
+
+// Looking at https://www.fefe.de/intof.html, casting the first part to long to not lose precision, then shifting and casting back
+#ifndef  MULT
+#define MULT(x, y) ((int)(((long)x * y) >> FIXED_FRACTION_BITS))
+#endif
+
 /********************************************************************************
  * Basic Usage of Helper Functions:
  *
@@ -25,185 +39,534 @@ static inline unsigned int fixed_to_address_roundup(int x, int exponent) {
 *   SIN / COS / TAN
 */
 
+#ifndef SIN_COS_TAN_ENABLED
+#define SIN_COS_TAN_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if SIN_COS_TAN_ENABLED > 0
+
 // Address generation function parameters
+#ifndef SIN_COS_TAN_PRECISION
 #define SIN_COS_TAN_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
 
 // Storage
 #ifndef SIN_COS_TAN_STORE_IN_WRAM
 #define SIN_COS_TAN_STORE_IN_WRAM 0
 #endif
 
+#define SIN_COS_TAN_TABLE_ID 0
+#if PACKED_TABLES > 0
+#define sin_cos_tan_granularity_exponent PACKED_INT_PARAMETER(SIN_COS_TAN_TABLE_ID)
+#else
 __host int sin_cos_tan_granularity_exponent;
+#endif
+#ifdef SIN_COS_TAN_GRANULARITY_EXPONENT_CONSTANT
+#undef sin_cos_tan_granularity_exponent
+#define sin_cos_tan_granularity_exponent SIN_COS_TAN_GRANULARITY_EXPONENT_CONSTANT
+#endif
 
-#if SIN_COS_TAN_STORE_IN_WRAM > 0
+#if SIN_COS_TAN_STORE_IN_WRAM > 0 && PACKED_TABLES == 0
 __host int sin_cos_tan_table[1 << SIN_COS_TAN_PRECISION];
 #else
+#if PACKED_TABLES > 0
+#define sin_cos_tan_table PACKED_TABLE(int, SIN_COS_TAN_TABLE_ID)
+#else
 __mram_noinit int sin_cos_tan_table[1 << SIN_COS_TAN_PRECISION];
 #endif
+#endif
 
 // Functions
-int sini(int x) {
+static inline int sini_core(int x, int granularity_exponent) {
     int quadrant;
-    unsigned int sin_x_fixed_point_offset = fixed_to_address_roundup(sin_cos_tan_in(x, &quadrant), sin_cos_tan_granularity_exponent);
+    unsigned int sin_x_fixed_point_offset = fixed_to_address_roundup(sin_cos_tan_in(x, &quadrant), granularity_exponent);
     int sin_y = sin_cos_tan_table[sin_x_fixed_point_offset];
     return sin_out(sin_y, &quadrant);
 }
 
-int cosi(int x) {
+int sini(int x) {
+    return sini_core(x, sin_cos_tan_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void sini_v(__mram_ptr const int *in, __mram_ptr int *out, uint32_t n) {
+    int granularity_exponent = sin_cos_tan_granularity_exponent;
+    VECTOR_LOOP(int, in, out, n, x, sini_core(x, granularity_exponent));
+}
+#endif
+
+static inline int cosi_core(int x, int granularity_exponent) {
     int quadrant;
-    unsigned int cos_x_fixed_point_offset = fixed_to_address_roundup(cos_to_sin_in(x, &quadrant), sin_cos_tan_granularity_exponent);
+    unsigned int cos_x_fixed_point_offset = fixed_to_address_roundup(cos_to_sin_in(x, &quadrant), granularity_exponent);
     int cos_y = sin_cos_tan_table[cos_x_fixed_point_offset];
     return sin_out(cos_y, &quadrant);
 }
 
-int tani(int x) {
+int cosi(int x) {
+    return cosi_core(x, sin_cos_tan_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void cosi_v(__mram_ptr const int *in, __mram_ptr int *out, uint32_t n) {
+    int granularity_exponent = sin_cos_tan_granularity_exponent;
+    VECTOR_LOOP(int, in, out, n, x, cosi_core(x, granularity_exponent));
+}
+#endif
+
+static inline int tani_core(int x, int granularity_exponent) {
     int quadrant;
-    unsigned int cos_x_fixed_point_offset = fixed_to_address_roundup(cos_to_sin_in(x, &quadrant), sin_cos_tan_granularity_exponent);
-    unsigned int sin_x_fixed_point_offset = fixed_to_address_roundup(sin_cos_tan_in(x, &quadrant), sin_cos_tan_granularity_exponent);
+    int x_reduced = sin_cos_tan_in(x, &quadrant);
+    unsigned int cos_x_fixed_point_offset = fixed_to_address_roundup(sin_to_cos_in(x_reduced), granularity_exponent);
+    unsigned int sin_x_fixed_point_offset = fixed_to_address_roundup(x_reduced, granularity_exponent);
 
     int cos_y = sin_cos_tan_table[cos_x_fixed_point_offset];
     int sin_y = sin_cos_tan_table[sin_x_fixed_point_offset];
     return tan_out(cos_y, sin_y, &quadrant);
 }
 
+int tani(int x) {
+    return tani_core(x, sin_cos_tan_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void tani_v(__mram_ptr const int *in, __mram_ptr int *out, uint32_t n) {
+    int granularity_exponent = sin_cos_tan_granularity_exponent;
+    VECTOR_LOOP(int, in, out, n, x, tani_core(x, granularity_exponent));
+}
+#endif
+
+// sin and cos of the same input, with only one range reduction
+static inline void sincosi_core(int x, int granularity_exponent, int *sin_ret, int *cos_ret) {
+    int quadrant;
+    int x_reduced = sin_cos_tan_in(x, &quadrant);
+    unsigned int sin_x_fixed_point_offset = fixed_to_address_roundup(x_reduced, granularity_exponent);
+    unsigned int cos_x_fixed_point_offset = fixed_to_address_roundup(sin_to_cos_in(x_reduced), granularity_exponent);
+
+    *sin_ret = sin_out(sin_cos_tan_table[sin_x_fixed_point_offset], &quadrant);
+    *cos_ret = cos_out(sin_cos_tan_table[cos_x_fixed_point_offset], &quadrant);
+}
+
+void sincosi(int x, int *sin_ret, int *cos_ret) {
+    sincosi_core(x, sin_cos_tan_granularity_exponent, sin_ret, cos_ret);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void sincosi_v(__mram_ptr const int *in, __mram_ptr int *out_sin, __mram_ptr int *out_cos, uint32_t n) {
+    int granularity_exponent = sin_cos_tan_granularity_exponent;
+    VECTOR_LOOP_PAIR(int, in, out_sin, out_cos, n, x, sin_y, cos_y, sincosi_core(x, granularity_exponent, sin_y, cos_y));
+}
+#endif
+
+#endif
+
 
 /***********************************************************
 *   SINH / COSH / TANH
 */
 
+#ifndef SINH_COSH_TANH_ENABLED
+#define SINH_COSH_TANH_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if SINH_COSH_TANH_ENABLED > 0
+
 // Address generation function parameters
+#ifndef SINH_COSH_TANH_PRECISION
 #define SINH_COSH_TANH_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
 
 // Storage
 #ifndef SINH_COSH_TANH_STORE_IN_WRAM
 #define SINH_COSH_TANH_STORE_IN_WRAM 0
 #endif
 
+#define SINH_TABLE_ID 1
+#if PACKED_TABLES > 0
+#define sinh_cosh_tanh_granularity_exponent PACKED_INT_PARAMETER(SINH_TABLE_ID)
+#else
 __host int sinh_cosh_tanh_granularity_exponent;
+#endif
+#ifdef SINH_COSH_TANH_GRANULARITY_EXPONENT_CONSTANT
+#undef sinh_cosh_tanh_granularity_exponent
+#define sinh_cosh_tanh_granularity_exponent SINH_COSH_TANH_GRANULARITY_EXPONENT_CONSTANT
+#endif
 
-#if SINH_COSH_TANH_STORE_IN_WRAM > 0
+#if SINH_COSH_TANH_STORE_IN_WRAM > 0 && PACKED_TABLES == 0
 __host int sinh_table[1 << SINH_COSH_TANH_PRECISION];
 #else
+#if PACKED_TABLES > 0
+#define sinh_table PACKED_TABLE(int, SINH_TABLE_ID)
+#else
 __mram_noinit int sinh_table[1 << SINH_COSH_TANH_PRECISION];
 #endif
+#endif
 
-#if SINH_COSH_TANH_STORE_IN_WRAM > 0
+#define COSH_TABLE_ID 2
+#if SINH_COSH_TANH_STORE_IN_WRAM > 0 && PACKED_TABLES == 0
 __host int cosh_table[1 << SINH_COSH_TANH_PRECISION];
 #else
+#if PACKED_TABLES > 0
+#define cosh_table PACKED_TABLE(int, COSH_TABLE_ID)
+#else
 __mram_noinit int cosh_table[1 << SINH_COSH_TANH_PRECISION];
 #endif
+#endif
 
 // Functions
-// TODO
+// log2(e) and log(2), saved as 2^32 * x so we can bitshift them right for our notation
+#define FIXED_LOG2_E (6196328019 >> (32 - FIXED_FRACTION_BITS))
+#define FIXED_LN_2 (2977044471 >> (32 - FIXED_FRACTION_BITS))
+
+// tanh(x) is 1 in fixed point for larger |x|, so these inputs don't need a lookup
+#define TANH_SATURATION_FIXED (16L << FIXED_FRACTION_BITS)
+
+/*
+ * Helper Function: |x| = k * log(2) + r, the table values are sinh(r) and cosh(r)
+ * sinh(|x|) = sinh_y << shift and cosh(|x|) = cosh_y << shift, the return value is the shift
+ * For k > 0, sinh_y and cosh_y are e^r -+ 2^(-2k) * e^-r and the shift is k - 1 (see sinh_cosh_range_extension_out() in _range_extensions.c)
+ * The results only fit into the fixed point format for |x| < (31 - FIXED_FRACTION_BITS) * log(2), tanhi() has no such limit
+ */
+static inline int sinh_cosh_abs(int x_abs, int granularity_exponent, int *sinh_y, int *cosh_y) {
+    int exponent_2pow_integer = MULT(x_abs, FIXED_LOG2_E) >> FIXED_FRACTION_BITS;
+    int x_reduced = x_abs - exponent_2pow_integer * FIXED_LN_2;
+
+    int offset_from_zero = fixed_to_address_roundup(x_reduced, granularity_exponent);
+    *sinh_y = sinh_table[offset_from_zero];
+    *cosh_y = cosh_table[offset_from_zero];
+
+    if (exponent_2pow_integer == 0) {
+        return 0;
+    }
+    int exp_y = *cosh_y + *sinh_y;
+    int exp_minus_y = (*cosh_y - *sinh_y) >> (exponent_2pow_integer < 16 ? 2 * exponent_2pow_integer : 31);
+    *sinh_y = exp_y - exp_minus_y;
+    *cosh_y = exp_y + exp_minus_y;
+    return exponent_2pow_integer - 1;
+}
+
+static inline int sinhi_core(int x, int granularity_exponent) {
+    int negative;
+    int sinh_y, cosh_y;
+    int shift = sinh_cosh_abs(symmetry_fold_fixed(x, &negative), granularity_exponent, &sinh_y, &cosh_y);
+    return symmetry_odd_fixed(sinh_y << shift, negative);
+}
+
+int sinhi(int x) {
+    return sinhi_core(x, sinh_cosh_tanh_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void sinhi_v(__mram_ptr const int *in, __mram_ptr int *out, uint32_t n) {
+    int granularity_exponent = sinh_cosh_tanh_granularity_exponent;
+    VECTOR_LOOP(int, in, out, n, x, sinhi_core(x, granularity_exponent));
+}
+#endif
+
+static inline int coshi_core(int x, int granularity_exponent) {
+    int sinh_y, cosh_y;
+    int shift = sinh_cosh_abs(x < 0 ? -x : x, granularity_exponent, &sinh_y, &cosh_y);
+    return cosh_y << shift;
+}
+
+int coshi(int x) {
+    return coshi_core(x, sinh_cosh_tanh_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void coshi_v(__mram_ptr const int *in, __mram_ptr int *out, uint32_t n) {
+    int granularity_exponent = sinh_cosh_tanh_granularity_exponent;
+    VECTOR_LOOP(int, in, out, n, x, coshi_core(x, granularity_exponent));
+}
+#endif
+
+static inline int tanhi_core(int x, int granularity_exponent) {
+    int negative;
+    int x_abs = symmetry_fold_fixed(x, &negative);
+    int y = 1 << FIXED_FRACTION_BITS;
+    if (x_abs < TANH_SATURATION_FIXED) {
+        // The shift is the same for both, so it cancels out
+        int sinh_y, cosh_y;
+        sinh_cosh_abs(x_abs, granularity_exponent, &sinh_y, &cosh_y);
+        y = DIV(sinh_y, cosh_y);
+    }
+    return symmetry_odd_fixed(y, negative);
+}
+
+int tanhi(int x) {
+    return tanhi_core(x, sinh_cosh_tanh_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void tanhi_v(__mram_ptr const int *in, __mram_ptr int *out, uint32_t n) {
+    int granularity_exponent = sinh_cosh_tanh_granularity_exponent;
+    VECTOR_LOOP(int, in, out, n, x, tanhi_core(x, granularity_exponent));
+}
+#endif
+
+// sinh and cosh of the same input, with only one range reduction
+static inline void sinhcoshi_core(int x, int granularity_exponent, int *sinh_ret, int *cosh_ret) {
+    int negative;
+    int sinh_y, cosh_y;
+    int shift = sinh_cosh_abs(symmetry_fold_fixed(x, &negative), granularity_exponent, &sinh_y, &cosh_y);
+    *sinh_ret = symmetry_odd_fixed(sinh_y << shift, negative);
+    *cosh_ret = cosh_y << shift;
+}
+
+void sinhcoshi(int x, int *sinh_ret, int *cosh_ret) {
+    sinhcoshi_core(x, sinh_cosh_tanh_granularity_exponent, sinh_ret, cosh_ret);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void sinhcoshi_v(__mram_ptr const int *in, __mram_ptr int *out_sinh, __mram_ptr int *out_cosh, uint32_t n) {
+    int granularity_exponent = sinh_cosh_tanh_granularity_exponent;
+    VECTOR_LOOP_PAIR(int, in, out_sinh, out_cosh, n, x, sinh_y, cosh_y, sinhcoshi_core(x, granularity_exponent, sinh_y, cosh_y));
+}
+#endif
+
+#endif
 
 
 /***********************************************************
 *   EXP
 */
 
+#ifndef EXP_ENABLED
+#define EXP_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if EXP_ENABLED > 0
+
 // Address generation function parameters
+#ifndef EXP_PRECISION
 #define EXP_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
 
 // Storage
 #ifndef EXP_STORE_IN_WRAM
 #define EXP_STORE_IN_WRAM 0
 #endif
 
+#define EXP_TABLE_ID 3
+#if PACKED_TABLES > 0
+#define exp_granularity_exponent PACKED_INT_PARAMETER(EXP_TABLE_ID)
+#else
 __host int exp_granularity_exponent;
+#endif
+#ifdef EXP_GRANULARITY_EXPONENT_CONSTANT
+#undef exp_granularity_exponent
+#define exp_granularity_exponent EXP_GRANULARITY_EXPONENT_CONSTANT
+#endif
 
-#if EXP_STORE_IN_WRAM > 0
+#if EXP_STORE_IN_WRAM > 0 && PACKED_TABLES == 0
 __host int exp_table[1 << EXP_PRECISION];
 #else
+#if PACKED_TABLES > 0
+#define exp_table PACKED_TABLE(int, EXP_TABLE_ID)
+#else
 __mram_noinit int exp_table[1 << EXP_PRECISION];
 #endif
+#endif
 
 // Functions
-int expi (int x) {
-    int offset_from_zero = fixed_to_address_roundup(x, exp_granularity_exponent);
+static inline int expi_core(int x, int granularity_exponent) {
+    int offset_from_zero = fixed_to_address_roundup(x, granularity_exponent);
     return exp_table[offset_from_zero];
 }
 
+int expi(int x) {
+    return expi_core(x, exp_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void expi_v(__mram_ptr const int *in, __mram_ptr int *out, uint32_t n) {
+    int granularity_exponent = exp_granularity_exponent;
+    VECTOR_LOOP(int, in, out, n, x, expi_core(x, granularity_exponent));
+}
+#endif
+
+#endif
+
 
 /***********************************************************
 *   LOG
 */
 
+#ifndef LOG_ENABLED
+#define LOG_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if LOG_ENABLED > 0
+
 // Address generation function parameters
+#ifndef LOG_PRECISION
 #define LOG_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
 
 // Storage
 #ifndef LOG_STORE_IN_WRAM
 #define LOG_STORE_IN_WRAM 0
 #endif
 
+#define LOG_TABLE_ID 4
+#if PACKED_TABLES > 0
+#define log_granularity_exponent PACKED_INT_PARAMETER(LOG_TABLE_ID)
+#else
 __host int log_granularity_exponent;
+#endif
+#ifdef LOG_GRANULARITY_EXPONENT_CONSTANT
+#undef log_granularity_exponent
+#define log_granularity_exponent LOG_GRANULARITY_EXPONENT_CONSTANT
+#endif
 
-#if LOG_STORE_IN_WRAM > 0
+#if LOG_STORE_IN_WRAM > 0 && PACKED_TABLES == 0
 __host int log_table[1 << LOG_PRECISION];
 #else
+#if PACKED_TABLES > 0
+#define log_table PACKED_TABLE(int, LOG_TABLE_ID)
+#else
 __mram_noinit int log_table[1 << LOG_PRECISION];
 #endif
+#endif
 
 // Function
-int logi(int x) {
-    int offset_from_zero = fixed_to_address_roundup(x, log_granularity_exponent);
+static inline int logi_core(int x, int granularity_exponent) {
+    int offset_from_zero = fixed_to_address_roundup(x, granularity_exponent);
     return log_table[offset_from_zero];
 }
 
+int logi(int x) {
+    return logi_core(x, log_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void logi_v(__mram_ptr const int *in, __mram_ptr int *out, uint32_t n) {
+    int granularity_exponent = log_granularity_exponent;
+    VECTOR_LOOP(int, in, out, n, x, logi_core(x, granularity_exponent));
+}
+#endif
+
+#endif
+
 
 /***********************************************************
 *   SQRT
 */
 
+#ifndef SQRT_ENABLED
+#define SQRT_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if SQRT_ENABLED > 0
+
 // Address generation function parameters
+#ifndef SQRT_PRECISION
 #define SQRT_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
 
 // Storage
 #ifndef SQRT_STORE_IN_WRAM
 #define SQRT_STORE_IN_WRAM 0
 #endif
 
+#define SQRT_TABLE_ID 5
+#if PACKED_TABLES > 0
+#define sqrt_granularity_exponent PACKED_INT_PARAMETER(SQRT_TABLE_ID)
+#else
 __host int sqrt_granularity_exponent;
+#endif
+#ifdef SQRT_GRANULARITY_EXPONENT_CONSTANT
+#undef sqrt_granularity_exponent
+#define sqrt_granularity_exponent SQRT_GRANULARITY_EXPONENT_CONSTANT
+#endif
 
-#if SQRT_STORE_IN_WRAM > 0
+#if SQRT_STORE_IN_WRAM > 0 && PACKED_TABLES == 0
 __host int sqrt_table[1 << SQRT_PRECISION];
 #else
+#if PACKED_TABLES > 0
+#define sqrt_table PACKED_TABLE(int, SQRT_TABLE_ID)
+#else
 __mram_noinit int sqrt_table[1 << SQRT_PRECISION];
 #endif
+#endif
 
 // Function
-int sqrti (int x) {
-    int offset_from_zero = fixed_to_address_roundup(x, sqrt_granularity_exponent);
+static inline int sqrti_core(int x, int granularity_exponent) {
+    int offset_from_zero = fixed_to_address_roundup(x, granularity_exponent);
     return sqrt_table[offset_from_zero];
 }
 
+int sqrti(int x) {
+    return sqrti_core(x, sqrt_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void sqrti_v(__mram_ptr const int *in, __mram_ptr int *out, uint32_t n) {
+    int granularity_exponent = sqrt_granularity_exponent;
+    VECTOR_LOOP(int, in, out, n, x, sqrti_core(x, granularity_exponent));
+}
+#endif
+
+#endif
+
+
 /***********************************************************
 *   CNDF
 */
 
+#ifndef CNDF_ENABLED
+#define CNDF_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if CNDF_ENABLED > 0
+
 // Address generation function parameters
+#ifndef CNDF_PRECISION
 #define CNDF_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
 
 // Storage
 #ifndef CNDF_STORE_IN_WRAM
 #define CNDF_STORE_IN_WRAM 0
 #endif
 
+#define CNDF_TABLE_ID 6
+#if PACKED_TABLES > 0
+#define cndf_granularity_exponent PACKED_INT_PARAMETER(CNDF_TABLE_ID)
+#else
 __host int cndf_granularity_exponent;
+#endif
+#ifdef CNDF_GRANULARITY_EXPONENT_CONSTANT
+#undef cndf_granularity_exponent
+#define cndf_granularity_exponent CNDF_GRANULARITY_EXPONENT_CONSTANT
+#endif
 
-#if CNDF_STORE_IN_WRAM > 0
-__host int cndf_table[1 << SQRT_PRECISION];
+// The table holds cndf(-x) for x >= 0, cndf(x) is 1 - cndf(-x) (see _symmetry_fixed.c)
+#if CNDF_STORE_IN_WRAM > 0 && PACKED_TABLES == 0
+__host int cndf_table[1 << CNDF_PRECISION];
 #else
-__mram_noinit int cndf_table[1 << SQRT_PRECISION];
+#if PACKED_TABLES > 0
+#define cndf_table PACKED_TABLE(int, CNDF_TABLE_ID)
+#else
+__mram_noinit int cndf_table[1 << CNDF_PRECISION];
+#endif
 #endif
 
 // Function
-int cndfi (int x) {
-    if (x > 0) {
-        int offset_from_zero = fixed_to_address_roundup(x, cndf_granularity_exponent);
-        return cndf_table[offset_from_zero];
-    } else {
-        int offset_from_zero = fixed_to_address_roundup(-x, cndf_granularity_exponent);
-        return (1 << (FIXED_FRACTION_BITS - 1)) -  cndf_table[offset_from_zero];
-    }
+static inline int cndfi_core(int x, int granularity_exponent) {
+    int negative;
+    int offset_from_zero = fixed_to_address_roundup(symmetry_fold_fixed(x, &negative), granularity_exponent);
+    return symmetry_complement_fixed(cndf_table[offset_from_zero], negative);
+}
+
+int cndfi(int x) {
+    return cndfi_core(x, cndf_granularity_exponent);
 }
+
+#if VECTOR_FUNCTIONS > 0
+void cndfi_v(__mram_ptr const int *in, __mram_ptr int *out, uint32_t n) {
+    int granularity_exponent = cndf_granularity_exponent;
+    VECTOR_LOOP(int, in, out, n, x, cndfi_core(x, granularity_exponent));
+}
+#endif
+
+#endif
@@ -1,4 +1,10 @@
 #include "_quadrants_fixed.c"
+#include "_symmetry_fixed.c"
+#include "_table_cache.c"
+#include "_packed_tables.c"
+#include "_table_staging.c"
+#include "_vector.c"
+#include "_table_constants.c"
 
 #pragma ide diagnostic ignored "UnusedParameter"
 #pragma ide diagnostic ignored "UnusedLocalVariable"
@@ -8,6 +14,11 @@
 #define PRECISION 10 // This needs to match on CPU and DPU side!
 #endif
 
+// Functions that are compiled in (single ones can be switched with <NAME>_ENABLED)
+#ifndef ALL_FUNCTIONS_ENABLED
+#define ALL_FUNCTIONS_ENABLED 1 // This needs to match on CPU and DPU side!
+#endif
+
 // Looking at https://www.fefe.de/intof.html, casting the first part to long to not lose precision, then shifting and casting back
 #ifndef  MULT
 #define MULT(x, y) ((int)(((long)x * y) >> FIXED_FRACTION_BITS))
@@ -18,8 +29,9 @@
  * *
  * unsigned int lower_address = fixed_to_address(x_fixed_point_offset, granularity_exponent);
  * int diff = fixed_to_diff(x_fixed_point_offset, granularity_exponent);
- * int base = table[lower_address];
- * return base + (table[lower_address + 1] - base) * diff;
+ * int base, delta;
+ * TABLE_DELTA(lower_address, base, delta);
+ * return base + MULT(delta, diff);
  */
 
 //Helper Function
@@ -37,214 +49,625 @@ static inline int fixed_to_diff(unsigned int x, int exponent) {
 *   SIN / COS / TAN
 */
 
+#ifndef SIN_COS_TAN_ENABLED
+#define SIN_COS_TAN_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if SIN_COS_TAN_ENABLED > 0
+
 // Address generation function parameters
+#ifndef SIN_COS_TAN_PRECISION
 #define SIN_COS_TAN_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
 
 // Storage
 #ifndef SIN_COS_TAN_STORE_IN_WRAM
 #define SIN_COS_TAN_STORE_IN_WRAM 0
 #endif
 
+#define SIN_COS_TAN_TABLE_ID 0
+#if PACKED_TABLES > 0
+#define sin_cos_tan_granularity_exponent PACKED_INT_PARAMETER(SIN_COS_TAN_TABLE_ID)
+#else
 __host int sin_cos_tan_granularity_exponent;
+#endif
+#ifdef SIN_COS_TAN_GRANULARITY_EXPONENT_CONSTANT
+#undef sin_cos_tan_granularity_exponent
+#define sin_cos_tan_granularity_exponent SIN_COS_TAN_GRANULARITY_EXPONENT_CONSTANT
+#endif
 
-#if SIN_COS_TAN_STORE_IN_WRAM > 0
-__host int sin_cos_tan_table[1 << SIN_COS_TAN_PRECISION];
+#if SIN_COS_TAN_STORE_IN_WRAM > 1 && PACKED_TABLES == 0
+STAGED_TABLE(int, sin_cos_tan_table, TABLE_WORDS(1 << SIN_COS_TAN_PRECISION), 1 << SIN_COS_TAN_PRECISION)
+#define SIN_COS_TAN_TABLE_DELTA(index, base, delta) WRAM_TABLE_DELTA(sin_cos_tan_table_wram, SIN_COS_TAN_TABLE_ID, index, base, delta)
+#define SIN_COS_TAN_TABLE_STAGING STAGE_TABLE(sin_cos_tan_table)
+#elif SIN_COS_TAN_STORE_IN_WRAM > 0 && PACKED_TABLES == 0
+__host int sin_cos_tan_table[TABLE_WORDS(1 << SIN_COS_TAN_PRECISION)];
+#define SIN_COS_TAN_TABLE_DELTA(index, base, delta) WRAM_TABLE_DELTA(sin_cos_tan_table, SIN_COS_TAN_TABLE_ID, index, base, delta)
 #else
-__mram_noinit int sin_cos_tan_table[1 << SIN_COS_TAN_PRECISION];
+#if PACKED_TABLES > 0
+#define sin_cos_tan_table PACKED_TABLE(int, SIN_COS_TAN_TABLE_ID)
+#else
+__mram_noinit int sin_cos_tan_table[TABLE_WORDS(1 << SIN_COS_TAN_PRECISION)];
+#endif
+#define SIN_COS_TAN_TABLE_DELTA(index, base, delta) MRAM_TABLE_DELTA(sin_cos_tan_table, SIN_COS_TAN_TABLE_ID, index, base, delta)
 #endif
 
 // Functions
-int sini(int x) {
+// Helper Function: table value at the reduced input (in the first quadrant)
+static inline int sin_cos_tan_interpolate(unsigned int x_fixed_point_offset, int granularity_exponent) {
+    unsigned int offset_addr_down = fixed_to_address(x_fixed_point_offset, granularity_exponent);
+
+    int diff = fixed_to_diff(x_fixed_point_offset, granularity_exponent);
+
+    int base, delta;
+    SIN_COS_TAN_TABLE_DELTA(offset_addr_down, base, delta);
+    return base +  MULT(delta, diff);
+}
+
+static inline int sini_core(int x, int granularity_exponent) {
     int quadrant;
     unsigned int x_fixed_point_offset = sin_cos_tan_in(x, &quadrant);
-    unsigned int offset_addr_down = fixed_to_address(x_fixed_point_offset, sin_cos_tan_granularity_exponent);
+    return sin_out(sin_cos_tan_interpolate(x_fixed_point_offset, granularity_exponent), &quadrant);
+}
 
-    int diff = fixed_to_diff(x_fixed_point_offset, sin_cos_tan_granularity_exponent);
+int sini(int x) {
+    return sini_core(x, sin_cos_tan_granularity_exponent);
+}
 
-    int base = sin_cos_tan_table[offset_addr_down];
-    int y = base +  MULT((sin_cos_tan_table[offset_addr_down + 1] - base), diff);
-    return sin_out(y, &quadrant);
+#if VECTOR_FUNCTIONS > 0
+void sini_v(__mram_ptr const int *in, __mram_ptr int *out, uint32_t n) {
+    int granularity_exponent = sin_cos_tan_granularity_exponent;
+    VECTOR_LOOP(int, in, out, n, x, sini_core(x, granularity_exponent));
 }
+#endif
 
-int cosi(int x) {
+static inline int cosi_core(int x, int granularity_exponent) {
     int quadrant;
     unsigned int x_fixed_point_offset = cos_to_sin_in(x, &quadrant);
-    unsigned int offset_addr_down = fixed_to_address(x_fixed_point_offset, sin_cos_tan_granularity_exponent);
+    return sin_out(sin_cos_tan_interpolate(x_fixed_point_offset, granularity_exponent), &quadrant);
+}
 
-    int diff = fixed_to_diff(x_fixed_point_offset, sin_cos_tan_granularity_exponent);
+int cosi(int x) {
+    return cosi_core(x, sin_cos_tan_granularity_exponent);
+}
 
-    int base = sin_cos_tan_table[offset_addr_down];
-    int y = base +  MULT((sin_cos_tan_table[offset_addr_down + 1] - base), diff);
-    return sin_out(y, &quadrant);
+#if VECTOR_FUNCTIONS > 0
+void cosi_v(__mram_ptr const int *in, __mram_ptr int *out, uint32_t n) {
+    int granularity_exponent = sin_cos_tan_granularity_exponent;
+    VECTOR_LOOP(int, in, out, n, x, cosi_core(x, granularity_exponent));
 }
+#endif
 
-int tani(int x) {
+static inline int tani_core(int x, int granularity_exponent) {
     int quadrant;
+    unsigned int x_fixed_point_offset = sin_cos_tan_in(x, &quadrant);
 
-    unsigned int cos_x_fixed_point_offset = cos_to_sin_in(x, &quadrant);
-    unsigned int cos_addr_down = fixed_to_address(cos_x_fixed_point_offset, sin_cos_tan_granularity_exponent);
+    int sin_y = sin_cos_tan_interpolate(x_fixed_point_offset, granularity_exponent);
+    int cos_y = sin_cos_tan_interpolate(sin_to_cos_in(x_fixed_point_offset), granularity_exponent);
+    return tan_out(cos_y, sin_y, &quadrant);
+}
 
-    unsigned int sin_x_fixed_point_offset = sin_cos_tan_in(x, &quadrant);
-    unsigned int sin_addr_down =  fixed_to_address(sin_x_fixed_point_offset, sin_cos_tan_granularity_exponent);
+int tani(int x) {
+    return tani_core(x, sin_cos_tan_granularity_exponent);
+}
 
-    int cos_diff = fixed_to_diff(cos_x_fixed_point_offset, sin_cos_tan_granularity_exponent);
-    int sin_diff = fixed_to_diff(sin_x_fixed_point_offset, sin_cos_tan_granularity_exponent);
+#if VECTOR_FUNCTIONS > 0
+void tani_v(__mram_ptr const int *in, __mram_ptr int *out, uint32_t n) {
+    int granularity_exponent = sin_cos_tan_granularity_exponent;
+    VECTOR_LOOP(int, in, out, n, x, tani_core(x, granularity_exponent));
+}
+#endif
 
-    int cos_base = sin_cos_tan_table[cos_addr_down];
-    int cos_y = cos_base +  MULT((sin_cos_tan_table[cos_addr_down + 1] - cos_base), cos_diff);
-    int sin_base = sin_cos_tan_table[sin_addr_down];
-    int sin_y = sin_base +  MULT((sin_cos_tan_table[sin_addr_down + 1] - sin_base), sin_diff);
+// sin and cos of the same input, with only one range reduction
+static inline void sincosi_core(int x, int granularity_exponent, int *sin_ret, int *cos_ret) {
+    int quadrant;
+    unsigned int x_fixed_point_offset = sin_cos_tan_in(x, &quadrant);
 
-    return tan_out(cos_y, sin_y, &quadrant);
+    *sin_ret = sin_out(sin_cos_tan_interpolate(x_fixed_point_offset, granularity_exponent), &quadrant);
+    *cos_ret = cos_out(sin_cos_tan_interpolate(sin_to_cos_in(x_fixed_point_offset), granularity_exponent), &quadrant);
+}
+
+void sincosi(int x, int *sin_ret, int *cos_ret) {
+    sincosi_core(x, sin_cos_tan_granularity_exponent, sin_ret, cos_ret);
 }
 
+#if VECTOR_FUNCTIONS > 0
+void sincosi_v(__mram_ptr const int *in, __mram_ptr int *out_sin, __mram_ptr int *out_cos, uint32_t n) {
+    int granularity_exponent = sin_cos_tan_granularity_exponent;
+    VECTOR_LOOP_PAIR(int, in, out_sin, out_cos, n, x, sin_y, cos_y, sincosi_core(x, granularity_exponent, sin_y, cos_y));
+}
+#endif
+
+#endif
+
 
 /***********************************************************
 *   SINH / COSH / TANH
 */
 
+#ifndef SINH_COSH_TANH_ENABLED
+#define SINH_COSH_TANH_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if SINH_COSH_TANH_ENABLED > 0
+
 // Address generation function parameters
+#ifndef SINH_COSH_TANH_PRECISION
 #define SINH_COSH_TANH_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
 
 // Storage
 #ifndef SINH_COSH_TANH_STORE_IN_WRAM
 #define SINH_COSH_TANH_STORE_IN_WRAM 0
 #endif
 
+#define SINH_TABLE_ID 1
+#if PACKED_TABLES > 0
+#define sinh_cosh_tanh_granularity_exponent PACKED_INT_PARAMETER(SINH_TABLE_ID)
+#else
 __host int sinh_cosh_tanh_granularity_exponent;
+#endif
+#ifdef SINH_COSH_TANH_GRANULARITY_EXPONENT_CONSTANT
+#undef sinh_cosh_tanh_granularity_exponent
+#define sinh_cosh_tanh_granularity_exponent SINH_COSH_TANH_GRANULARITY_EXPONENT_CONSTANT
+#endif
 
-#if SINH_COSH_TANH_STORE_IN_WRAM > 0
-__host int sinh_table[1 << SINH_COSH_TANH_PRECISION];
+#if SINH_COSH_TANH_STORE_IN_WRAM > 1 && PACKED_TABLES == 0
+STAGED_TABLE(int, sinh_table, TABLE_WORDS(1 << SINH_COSH_TANH_PRECISION), 1 << SINH_COSH_TANH_PRECISION)
+#define SINH_TABLE_DELTA(index, base, delta) WRAM_TABLE_DELTA(sinh_table_wram, SINH_TABLE_ID, index, base, delta)
+#define SINH_TABLE_STAGING STAGE_TABLE(sinh_table)
+#elif SINH_COSH_TANH_STORE_IN_WRAM > 0 && PACKED_TABLES == 0
+__host int sinh_table[TABLE_WORDS(1 << SINH_COSH_TANH_PRECISION)];
+#define SINH_TABLE_DELTA(index, base, delta) WRAM_TABLE_DELTA(sinh_table, SINH_TABLE_ID, index, base, delta)
+#else
+#if PACKED_TABLES > 0
+#define sinh_table PACKED_TABLE(int, SINH_TABLE_ID)
 #else
-__mram_noinit int sinh_table[1 << SINH_COSH_TANH_PRECISION];
+__mram_noinit int sinh_table[TABLE_WORDS(1 << SINH_COSH_TANH_PRECISION)];
+#endif
+#define SINH_TABLE_DELTA(index, base, delta) MRAM_TABLE_DELTA(sinh_table, SINH_TABLE_ID, index, base, delta)
 #endif
 
-#if SINH_COSH_TANH_STORE_IN_WRAM > 0
-__host int cosh_table[1 << SINH_COSH_TANH_PRECISION];
+#define COSH_TABLE_ID 2
+#if SINH_COSH_TANH_STORE_IN_WRAM > 1 && PACKED_TABLES == 0
+STAGED_TABLE(int, cosh_table, TABLE_WORDS(1 << SINH_COSH_TANH_PRECISION), 1 << SINH_COSH_TANH_PRECISION)
+#define COSH_TABLE_DELTA(index, base, delta) WRAM_TABLE_DELTA(cosh_table_wram, COSH_TABLE_ID, index, base, delta)
+#define COSH_TABLE_STAGING STAGE_TABLE(cosh_table)
+#elif SINH_COSH_TANH_STORE_IN_WRAM > 0 && PACKED_TABLES == 0
+__host int cosh_table[TABLE_WORDS(1 << SINH_COSH_TANH_PRECISION)];
+#define COSH_TABLE_DELTA(index, base, delta) WRAM_TABLE_DELTA(cosh_table, COSH_TABLE_ID, index, base, delta)
+#else
+#if PACKED_TABLES > 0
+#define cosh_table PACKED_TABLE(int, COSH_TABLE_ID)
 #else
-__mram_noinit int cosh_table[1 << SINH_COSH_TANH_PRECISION];
+__mram_noinit int cosh_table[TABLE_WORDS(1 << SINH_COSH_TANH_PRECISION)];
+#endif
+#define COSH_TABLE_DELTA(index, base, delta) MRAM_TABLE_DELTA(cosh_table, COSH_TABLE_ID, index, base, delta)
 #endif
 
 // Functions
-// TODO
+// log2(e) and log(2), saved as 2^32 * x so we can bitshift them right for our notation
+#define FIXED_LOG2_E (6196328019 >> (32 - FIXED_FRACTION_BITS))
+#define FIXED_LN_2 (2977044471 >> (32 - FIXED_FRACTION_BITS))
+
+// tanh(x) is 1 in fixed point for larger |x|, so these inputs don't need a lookup
+#define TANH_SATURATION_FIXED (16L << FIXED_FRACTION_BITS)
+
+/*
+ * Helper Function: |x| = k * log(2) + r, the table values are sinh(r) and cosh(r)
+ * sinh(|x|) = sinh_y << shift and cosh(|x|) = cosh_y << shift, the return value is the shift
+ * For k > 0, sinh_y and cosh_y are e^r -+ 2^(-2k) * e^-r and the shift is k - 1 (see sinh_cosh_range_extension_out() in _range_extensions.c)
+ * The results only fit into the fixed point format for |x| < (31 - FIXED_FRACTION_BITS) * log(2), tanhi() has no such limit
+ */
+static inline int sinh_cosh_abs(int x_abs, int granularity_exponent, int *sinh_y, int *cosh_y) {
+    int exponent_2pow_integer = MULT(x_abs, FIXED_LOG2_E) >> FIXED_FRACTION_BITS;
+    int x_reduced = x_abs - exponent_2pow_integer * FIXED_LN_2;
+
+    unsigned int lower_address = fixed_to_address(x_reduced, granularity_exponent);
+    int diff = fixed_to_diff(x_reduced, granularity_exponent);
+    int base, delta;
+    SINH_TABLE_DELTA(lower_address, base, delta);
+    *sinh_y = base + MULT(delta, diff);
+    COSH_TABLE_DELTA(lower_address, base, delta);
+    *cosh_y = base + MULT(delta, diff);
+
+    if (exponent_2pow_integer == 0) {
+        return 0;
+    }
+    int exp_y = *cosh_y + *sinh_y;
+    int exp_minus_y = (*cosh_y - *sinh_y) >> (exponent_2pow_integer < 16 ? 2 * exponent_2pow_integer : 31);
+    *sinh_y = exp_y - exp_minus_y;
+    *cosh_y = exp_y + exp_minus_y;
+    return exponent_2pow_integer - 1;
+}
+
+static inline int sinhi_core(int x, int granularity_exponent) {
+    int negative;
+    int sinh_y, cosh_y;
+    int shift = sinh_cosh_abs(symmetry_fold_fixed(x, &negative), granularity_exponent, &sinh_y, &cosh_y);
+    return symmetry_odd_fixed(sinh_y << shift, negative);
+}
+
+int sinhi(int x) {
+    return sinhi_core(x, sinh_cosh_tanh_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void sinhi_v(__mram_ptr const int *in, __mram_ptr int *out, uint32_t n) {
+    int granularity_exponent = sinh_cosh_tanh_granularity_exponent;
+    VECTOR_LOOP(int, in, out, n, x, sinhi_core(x, granularity_exponent));
+}
+#endif
+
+static inline int coshi_core(int x, int granularity_exponent) {
+    int sinh_y, cosh_y;
+    int shift = sinh_cosh_abs(x < 0 ? -x : x, granularity_exponent, &sinh_y, &cosh_y);
+    return cosh_y << shift;
+}
+
+int coshi(int x) {
+    return coshi_core(x, sinh_cosh_tanh_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void coshi_v(__mram_ptr const int *in, __mram_ptr int *out, uint32_t n) {
+    int granularity_exponent = sinh_cosh_tanh_granularity_exponent;
+    VECTOR_LOOP(int, in, out, n, x, coshi_core(x, granularity_exponent));
+}
+#endif
+
+static inline int tanhi_core(int x, int granularity_exponent) {
+    int negative;
+    int x_abs = symmetry_fold_fixed(x, &negative);
+    int y = 1 << FIXED_FRACTION_BITS;
+    if (x_abs < TANH_SATURATION_FIXED) {
+        // The shift is the same for both, so it cancels out
+        int sinh_y, cosh_y;
+        sinh_cosh_abs(x_abs, granularity_exponent, &sinh_y, &cosh_y);
+        y = DIV(sinh_y, cosh_y);
+    }
+    return symmetry_odd_fixed(y, negative);
+}
+
+int tanhi(int x) {
+    return tanhi_core(x, sinh_cosh_tanh_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void tanhi_v(__mram_ptr const int *in, __mram_ptr int *out, uint32_t n) {
+    int granularity_exponent = sinh_cosh_tanh_granularity_exponent;
+    VECTOR_LOOP(int, in, out, n, x, tanhi_core(x, granularity_exponent));
+}
+#endif
+
+// sinh and cosh of the same input, with only one range reduction
+static inline void sinhcoshi_core(int x, int granularity_exponent, int *sinh_ret, int *cosh_ret) {
+    int negative;
+    int sinh_y, cosh_y;
+    int shift = sinh_cosh_abs(symmetry_fold_fixed(x, &negative), granularity_exponent, &sinh_y, &cosh_y);
+    *sinh_ret = symmetry_odd_fixed(sinh_y << shift, negative);
+    *cosh_ret = cosh_y << shift;
+}
+
+void sinhcoshi(int x, int *sinh_ret, int *cosh_ret) {
+    sinhcoshi_core(x, sinh_cosh_tanh_granularity_exponent, sinh_ret, cosh_ret);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void sinhcoshi_v(__mram_ptr const int *in, __mram_ptr int *out_sinh, __mram_ptr int *out_cosh, uint32_t n) {
+    int granularity_exponent = sinh_cosh_tanh_granularity_exponent;
+    VECTOR_LOOP_PAIR(int, in, out_sinh, out_cosh, n, x, sinh_y, cosh_y, sinhcoshi_core(x, granularity_exponent, sinh_y, cosh_y));
+}
+#endif
+
+#endif
 
 
 /***********************************************************
 *   EXP
 */
 
+#ifndef EXP_ENABLED
+#define EXP_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if EXP_ENABLED > 0
+
 // Address generation function parameters
+#ifndef EXP_PRECISION
 #define EXP_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
 
 // Storage
 #ifndef EXP_STORE_IN_WRAM
 #define EXP_STORE_IN_WRAM 0
 #endif
 
+#define EXP_TABLE_ID 3
+#if PACKED_TABLES > 0
+#define exp_granularity_exponent PACKED_INT_PARAMETER(EXP_TABLE_ID)
+#else
 __host int exp_granularity_exponent;
+#endif
+#ifdef EXP_GRANULARITY_EXPONENT_CONSTANT
+#undef exp_granularity_exponent
+#define exp_granularity_exponent EXP_GRANULARITY_EXPONENT_CONSTANT
+#endif
 
-#if EXP_STORE_IN_WRAM > 0
-__host int exp_table[1 << EXP_PRECISION];
+#if EXP_STORE_IN_WRAM > 1 && PACKED_TABLES == 0
+STAGED_TABLE(int, exp_table, TABLE_WORDS(1 << EXP_PRECISION), 1 << EXP_PRECISION)
+#define EXP_TABLE_DELTA(index, base, delta) WRAM_TABLE_DELTA(exp_table_wram, EXP_TABLE_ID, index, base, delta)
+#define EXP_TABLE_STAGING STAGE_TABLE(exp_table)
+#elif EXP_STORE_IN_WRAM > 0 && PACKED_TABLES == 0
+__host int exp_table[TABLE_WORDS(1 << EXP_PRECISION)];
+#define EXP_TABLE_DELTA(index, base, delta) WRAM_TABLE_DELTA(exp_table, EXP_TABLE_ID, index, base, delta)
+#else
+#if PACKED_TABLES > 0
+#define exp_table PACKED_TABLE(int, EXP_TABLE_ID)
 #else
-__mram_noinit int exp_table[1 << EXP_PRECISION];
+__mram_noinit int exp_table[TABLE_WORDS(1 << EXP_PRECISION)];
+#endif
+#define EXP_TABLE_DELTA(index, base, delta) MRAM_TABLE_DELTA(exp_table, EXP_TABLE_ID, index, base, delta)
 #endif
 
 // Functions
-int expi (int x) {
-    unsigned int lower_address = fixed_to_address(x, exp_granularity_exponent);
-    int diff = fixed_to_diff(x, exp_granularity_exponent);
-    int base = exp_table[lower_address];
-    return base + MULT((exp_table[lower_address + 1] - base), diff);
+static inline int expi_core(int x, int granularity_exponent) {
+    unsigned int lower_address = fixed_to_address(x, granularity_exponent);
+    int diff = fixed_to_diff(x, granularity_exponent);
+    int base, delta;
+    EXP_TABLE_DELTA(lower_address, base, delta);
+    return base + MULT(delta, diff);
+}
+
+int expi(int x) {
+    return expi_core(x, exp_granularity_exponent);
 }
 
+#if VECTOR_FUNCTIONS > 0
+void expi_v(__mram_ptr const int *in, __mram_ptr int *out, uint32_t n) {
+    int granularity_exponent = exp_granularity_exponent;
+    VECTOR_LOOP(int, in, out, n, x, expi_core(x, granularity_exponent));
+}
+#endif
+
+#endif
+
 
 /***********************************************************
 *   LOG
 */
 
+#ifndef LOG_ENABLED
+#define LOG_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if LOG_ENABLED > 0
+
 // Address generation function parameters
+#ifndef LOG_PRECISION
 #define LOG_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
 
 // Storage
 #ifndef LOG_STORE_IN_WRAM
 #define LOG_STORE_IN_WRAM 0
 #endif
 
+#define LOG_TABLE_ID 4
+#if PACKED_TABLES > 0
+#define log_granularity_exponent PACKED_INT_PARAMETER(LOG_TABLE_ID)
+#else
 __host int log_granularity_exponent;
+#endif
+#ifdef LOG_GRANULARITY_EXPONENT_CONSTANT
+#undef log_granularity_exponent
+#define log_granularity_exponent LOG_GRANULARITY_EXPONENT_CONSTANT
+#endif
 
-#if LOG_STORE_IN_WRAM > 0
-__host int log_table[1 << LOG_PRECISION];
+#if LOG_STORE_IN_WRAM > 1 && PACKED_TABLES == 0
+STAGED_TABLE(int, log_table, TABLE_WORDS(1 << LOG_PRECISION), 1 << LOG_PRECISION)
+#define LOG_TABLE_DELTA(index, base, delta) WRAM_TABLE_DELTA(log_table_wram, LOG_TABLE_ID, index, base, delta)
+#define LOG_TABLE_STAGING STAGE_TABLE(log_table)
+#elif LOG_STORE_IN_WRAM > 0 && PACKED_TABLES == 0
+__host int log_table[TABLE_WORDS(1 << LOG_PRECISION)];
+#define LOG_TABLE_DELTA(index, base, delta) WRAM_TABLE_DELTA(log_table, LOG_TABLE_ID, index, base, delta)
+#else
+#if PACKED_TABLES > 0
+#define log_table PACKED_TABLE(int, LOG_TABLE_ID)
 #else
-__mram_noinit int log_table[1 << LOG_PRECISION];
+__mram_noinit int log_table[TABLE_WORDS(1 << LOG_PRECISION)];
+#endif
+#define LOG_TABLE_DELTA(index, base, delta) MRAM_TABLE_DELTA(log_table, LOG_TABLE_ID, index, base, delta)
 #endif
 
 // Function
-int logi (int x) {
-    unsigned int lower_address = fixed_to_address(x, log_granularity_exponent);
-    int diff = fixed_to_diff(x, log_granularity_exponent);
-    int base = log_table[lower_address];
-    return base + MULT((log_table[lower_address + 1] - base), diff);
+static inline int logi_core(int x, int granularity_exponent) {
+    unsigned int lower_address = fixed_to_address(x, granularity_exponent);
+    int diff = fixed_to_diff(x, granularity_exponent);
+    int base, delta;
+    LOG_TABLE_DELTA(lower_address, base, delta);
+    return base + MULT(delta, diff);
+}
+
+int logi(int x) {
+    return logi_core(x, log_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void logi_v(__mram_ptr const int *in, __mram_ptr int *out, uint32_t n) {
+    int granularity_exponent = log_granularity_exponent;
+    VECTOR_LOOP(int, in, out, n, x, logi_core(x, granularity_exponent));
 }
+#endif
+
+#endif
+
 
 /***********************************************************
 *   SQRT
 */
 
+#ifndef SQRT_ENABLED
+#define SQRT_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if SQRT_ENABLED > 0
+
 // Address generation function parameters
+#ifndef SQRT_PRECISION
 #define SQRT_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
 
 // Storage
 #ifndef SQRT_STORE_IN_WRAM
 #define SQRT_STORE_IN_WRAM 0
 #endif
 
+#define SQRT_TABLE_ID 5
+#if PACKED_TABLES > 0
+#define sqrt_granularity_exponent PACKED_INT_PARAMETER(SQRT_TABLE_ID)
+#else
 __host int sqrt_granularity_exponent;
+#endif
+#ifdef SQRT_GRANULARITY_EXPONENT_CONSTANT
+#undef sqrt_granularity_exponent
+#define sqrt_granularity_exponent SQRT_GRANULARITY_EXPONENT_CONSTANT
+#endif
 
-#if SQRT_STORE_IN_WRAM > 0
-__host int sqrt_table[1 << SQRT_PRECISION];
+#if SQRT_STORE_IN_WRAM > 1 && PACKED_TABLES == 0
+STAGED_TABLE(int, sqrt_table, TABLE_WORDS(1 << SQRT_PRECISION), 1 << SQRT_PRECISION)
+#define SQRT_TABLE_DELTA(index, base, delta) WRAM_TABLE_DELTA(sqrt_table_wram, SQRT_TABLE_ID, index, base, delta)
+#define SQRT_TABLE_STAGING STAGE_TABLE(sqrt_table)
+#elif SQRT_STORE_IN_WRAM > 0 && PACKED_TABLES == 0
+__host int sqrt_table[TABLE_WORDS(1 << SQRT_PRECISION)];
+#define SQRT_TABLE_DELTA(index, base, delta) WRAM_TABLE_DELTA(sqrt_table, SQRT_TABLE_ID, index, base, delta)
+#else
+#if PACKED_TABLES > 0
+#define sqrt_table PACKED_TABLE(int, SQRT_TABLE_ID)
 #else
-__mram_noinit int sqrt_table[1 << SQRT_PRECISION];
+__mram_noinit int sqrt_table[TABLE_WORDS(1 << SQRT_PRECISION)];
+#endif
+#define SQRT_TABLE_DELTA(index, base, delta) MRAM_TABLE_DELTA(sqrt_table, SQRT_TABLE_ID, index, base, delta)
 #endif
 
 // Function
-int sqrti (int x) {
-    unsigned int lower_address = fixed_to_address(x, sqrt_granularity_exponent);
-    int diff = fixed_to_diff(x, sqrt_granularity_exponent);
-    int base = sqrt_table[lower_address];
-    return base + MULT((sqrt_table[lower_address + 1] - base), diff);
+static inline int sqrti_core(int x, int granularity_exponent) {
+    unsigned int lower_address = fixed_to_address(x, granularity_exponent);
+    int diff = fixed_to_diff(x, granularity_exponent);
+    int base, delta;
+    SQRT_TABLE_DELTA(lower_address, base, delta);
+    return base + MULT(delta, diff);
 }
 
+int sqrti(int x) {
+    return sqrti_core(x, sqrt_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void sqrti_v(__mram_ptr const int *in, __mram_ptr int *out, uint32_t n) {
+    int granularity_exponent = sqrt_granularity_exponent;
+    VECTOR_LOOP(int, in, out, n, x, sqrti_core(x, granularity_exponent));
+}
+#endif
+
+#endif
+
+
 /***********************************************************
 *   CNDF
 */
 
+#ifndef CNDF_ENABLED
+#define CNDF_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if CNDF_ENABLED > 0
+
 // Address generation function parameters
+#ifndef CNDF_PRECISION
 #define CNDF_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
 
 // Storage
 #ifndef CNDF_STORE_IN_WRAM
 #define CNDF_STORE_IN_WRAM 0
 #endif
 
+#define CNDF_TABLE_ID 6
+#if PACKED_TABLES > 0
+#define cndf_granularity_exponent PACKED_INT_PARAMETER(CNDF_TABLE_ID)
+#else
 __host int cndf_granularity_exponent;
+#endif
+#ifdef CNDF_GRANULARITY_EXPONENT_CONSTANT
+#undef cndf_granularity_exponent
+#define cndf_granularity_exponent CNDF_GRANULARITY_EXPONENT_CONSTANT
+#endif
 
-#if CNDF_STORE_IN_WRAM > 0
-__host int cndf_table[1 << SQRT_PRECISION];
+// The table holds cndf(-x) for x >= 0, cndf(x) is 1 - cndf(-x) (see _symmetry_fixed.c)
+#if CNDF_STORE_IN_WRAM > 1 && PACKED_TABLES == 0
+STAGED_TABLE(int, cndf_table, TABLE_WORDS(1 << CNDF_PRECISION), 1 << CNDF_PRECISION)
+#define CNDF_TABLE_DELTA(index, base, delta) WRAM_TABLE_DELTA(cndf_table_wram, CNDF_TABLE_ID, index, base, delta)
+#define CNDF_TABLE_STAGING STAGE_TABLE(cndf_table)
+#elif CNDF_STORE_IN_WRAM > 0 && PACKED_TABLES == 0
+__host int cndf_table[TABLE_WORDS(1 << CNDF_PRECISION)];
+#define CNDF_TABLE_DELTA(index, base, delta) WRAM_TABLE_DELTA(cndf_table, CNDF_TABLE_ID, index, base, delta)
 #else
-__mram_noinit int cndf_table[1 << SQRT_PRECISION];
+#if PACKED_TABLES > 0
+#define cndf_table PACKED_TABLE(int, CNDF_TABLE_ID)
+#else
+__mram_noinit int cndf_table[TABLE_WORDS(1 << CNDF_PRECISION)];
+#endif
+#define CNDF_TABLE_DELTA(index, base, delta) MRAM_TABLE_DELTA(cndf_table, CNDF_TABLE_ID, index, base, delta)
 #endif
 
 // Function
-int cndfi (int x) {
-    if (x > 0) {
-        unsigned int lower_address = fixed_to_address(x, cndf_granularity_exponent);
-        int diff = fixed_to_diff(x, cndf_granularity_exponent);
-        int base = cndf_table[lower_address];
-        return base + MULT((cndf_table[lower_address + 1] - base), diff);
-    } else {
-        unsigned int lower_address = fixed_to_address(-x, cndf_granularity_exponent);
-        int diff = fixed_to_diff(x, cndf_granularity_exponent);
-        int base = cndf_table[lower_address];
-        return (1 << (FIXED_FRACTION_BITS - 1)) - base - MULT((cndf_table[lower_address + 1] - base), diff);
-    }
-}
\ No newline at end of file
+static inline int cndfi_core(int x, int granularity_exponent) {
+    int negative;
+    int x_abs = symmetry_fold_fixed(x, &negative);
+    unsigned int lower_address = fixed_to_address(x_abs, granularity_exponent);
+    int diff = fixed_to_diff(x_abs, granularity_exponent);
+    int base, delta;
+    CNDF_TABLE_DELTA(lower_address, base, delta);
+    return symmetry_complement_fixed(base + MULT(delta, diff), negative);
+}
+
+int cndfi(int x) {
+    return cndfi_core(x, cndf_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void cndfi_v(__mram_ptr const int *in, __mram_ptr int *out, uint32_t n) {
+    int granularity_exponent = cndf_granularity_exponent;
+    VECTOR_LOOP(int, in, out, n, x, cndfi_core(x, granularity_exponent));
+}
+#endif
+
+#endif
+
+// Copies the staged tables (<NAME>_STORE_IN_WRAM=2) into WRAM, needs to be called by all tasklets before the first lookup
+void table_staging() {
+    TABLE_STAGING_START();
+#ifdef SIN_COS_TAN_TABLE_STAGING
+    SIN_COS_TAN_TABLE_STAGING;
+#endif
+#ifdef SINH_TABLE_STAGING
+    SINH_TABLE_STAGING;
+#endif
+#ifdef COSH_TABLE_STAGING
+    COSH_TABLE_STAGING;
+#endif
+#ifdef EXP_TABLE_STAGING
+    EXP_TABLE_STAGING;
+#endif
+#ifdef LOG_TABLE_STAGING
+    LOG_TABLE_STAGING;
+#endif
+#ifdef SQRT_TABLE_STAGING
+    SQRT_TABLE_STAGING;
+#endif
+#ifdef CNDF_TABLE_STAGING
+    CNDF_TABLE_STAGING;
+#endif
+    TABLE_STAGING_END();
+}
@@ -1,5 +1,9 @@
 #include "_ldexpf.c"
 #include "_quadrants.c"
+#include "_symmetry.c"
+#include "_packed_tables.c"
+#include "_vector.c"
+#include "_table_constants.c"
 
 #pragma ide diagnostic ignored "UnusedParameter"
 #pragma ide diagnostic ignored "UnusedLocalVariable"
@@ -9,6 +13,11 @@
 #define PRECISION 10 // This needs to match on CPU and DPU side!
 #endif
 
+// Functions that are compiled in (single ones can be switched with <NAME>_ENABLED)
+#ifndef ALL_FUNCTIONS_ENABLED
+#define ALL_FUNCTIONS_ENABLED 1 // This needs to match on CPU and DPU side!
+#endif
+
 /********************************************************************************
  * Basic Usage of Helper Functions:
  *
@@ -31,172 +40,475 @@ static inline unsigned int fixed_to_address_roundup_ldexpf(int x, int exponent)
 *   SIN / COS / TAN
 */
 
+#ifndef SIN_COS_TAN_ENABLED
+#define SIN_COS_TAN_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if SIN_COS_TAN_ENABLED > 0
+
 // Address generation function parameters
+#ifndef SIN_COS_TAN_PRECISION
 #define SIN_COS_TAN_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
 
 // Storage
 #ifndef SIN_COS_TAN_STORE_IN_WRAM
 #define SIN_COS_TAN_STORE_IN_WRAM 0
 #endif
 
+#define SIN_COS_TAN_TABLE_ID 0
+#if PACKED_TABLES > 0
+#define sin_cos_tan_granularity_exponent PACKED_INT_PARAMETER(SIN_COS_TAN_TABLE_ID)
+#else
 __host int sin_cos_tan_granularity_exponent;
+#endif
+#ifdef SIN_COS_TAN_GRANULARITY_EXPONENT_CONSTANT
+#undef sin_cos_tan_granularity_exponent
+#define sin_cos_tan_granularity_exponent SIN_COS_TAN_GRANULARITY_EXPONENT_CONSTANT
+#endif
 
-#if SIN_COS_TAN_STORE_IN_WRAM > 0
+#if SIN_COS_TAN_STORE_IN_WRAM > 0 && PACKED_TABLES == 0
 __host float sin_cos_tan_table[1 << SIN_COS_TAN_PRECISION];
 #else
+#if PACKED_TABLES > 0
+#define sin_cos_tan_table PACKED_TABLE(float, SIN_COS_TAN_TABLE_ID)
+#else
 __mram_noinit float sin_cos_tan_table[1 << SIN_COS_TAN_PRECISION];
 #endif
+#endif
 
 // Functions
-float sinf(float x) {
+static inline float sinf_core(float x, int granularity_exponent) {
     int quadrant;
-    unsigned int sin_x_fixed_point_offset = fixed_to_address_roundup_ldexpf(sin_cos_tan_in(x, &quadrant), sin_cos_tan_granularity_exponent);
+    unsigned int sin_x_fixed_point_offset = fixed_to_address_roundup_ldexpf(sin_cos_tan_in(x, &quadrant), granularity_exponent);
     float sin_y = sin_cos_tan_table[sin_x_fixed_point_offset];
     return sin_float_out(sin_y, &quadrant);
 }
 
-float cosf(float x) {
+float sinf(float x) {
+    return sinf_core(x, sin_cos_tan_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void sinf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    int granularity_exponent = sin_cos_tan_granularity_exponent;
+    VECTOR_LOOP(float, in, out, n, x, sinf_core(x, granularity_exponent));
+}
+#endif
+
+static inline float cosf_core(float x, int granularity_exponent) {
     int quadrant;
-    unsigned int cos_x_fixed_point_offset = fixed_to_address_roundup_ldexpf(cos_to_sin_in(x, &quadrant), sin_cos_tan_granularity_exponent);
+    unsigned int cos_x_fixed_point_offset = fixed_to_address_roundup_ldexpf(cos_to_sin_in(x, &quadrant), granularity_exponent);
     float cos_y = sin_cos_tan_table[cos_x_fixed_point_offset];
     return sin_float_out(cos_y, &quadrant);
 }
 
-float tanf(float x) {
+float cosf(float x) {
+    return cosf_core(x, sin_cos_tan_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void cosf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    int granularity_exponent = sin_cos_tan_granularity_exponent;
+    VECTOR_LOOP(float, in, out, n, x, cosf_core(x, granularity_exponent));
+}
+#endif
+
+static inline float tanf_core(float x, int granularity_exponent) {
     int quadrant;
-    unsigned int cos_x_fixed_point_offset = fixed_to_address_roundup_ldexpf(cos_to_sin_in(x, &quadrant), sin_cos_tan_granularity_exponent);
-    unsigned int sin_x_fixed_point_offset = fixed_to_address_roundup_ldexpf(sin_cos_tan_in(x, &quadrant), sin_cos_tan_granularity_exponent);
+    int x_fixed_point = sin_cos_tan_in(x, &quadrant);
+    unsigned int cos_x_fixed_point_offset = fixed_to_address_roundup_ldexpf(sin_to_cos_in(x_fixed_point), granularity_exponent);
+    unsigned int sin_x_fixed_point_offset = fixed_to_address_roundup_ldexpf(x_fixed_point, granularity_exponent);
 
     float cos_y = sin_cos_tan_table[cos_x_fixed_point_offset];
     float sin_y = sin_cos_tan_table[sin_x_fixed_point_offset];
     return tan_float_out(cos_y, sin_y, &quadrant);
 }
 
+float tanf(float x) {
+    return tanf_core(x, sin_cos_tan_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void tanf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    int granularity_exponent = sin_cos_tan_granularity_exponent;
+    VECTOR_LOOP(float, in, out, n, x, tanf_core(x, granularity_exponent));
+}
+#endif
+
+// sin and cos of the same input, with only one range reduction
+static inline void sincosf_core(float x, int granularity_exponent, float *sin_ret, float *cos_ret) {
+    int quadrant;
+    int x_fixed_point = sin_cos_tan_in(x, &quadrant);
+    unsigned int sin_x_fixed_point_offset = fixed_to_address_roundup_ldexpf(x_fixed_point, granularity_exponent);
+    unsigned int cos_x_fixed_point_offset = fixed_to_address_roundup_ldexpf(sin_to_cos_in(x_fixed_point), granularity_exponent);
+
+    *sin_ret = sin_float_out(sin_cos_tan_table[sin_x_fixed_point_offset], &quadrant);
+    *cos_ret = cos_float_out(sin_cos_tan_table[cos_x_fixed_point_offset], &quadrant);
+}
+
+void sincosf(float x, float *sin_ret, float *cos_ret) {
+    sincosf_core(x, sin_cos_tan_granularity_exponent, sin_ret, cos_ret);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void sincosf_v(__mram_ptr const float *in, __mram_ptr float *out_sin, __mram_ptr float *out_cos, uint32_t n) {
+    int granularity_exponent = sin_cos_tan_granularity_exponent;
+    VECTOR_LOOP_PAIR(float, in, out_sin, out_cos, n, x, sin_y, cos_y, sincosf_core(x, granularity_exponent, sin_y, cos_y));
+}
+#endif
+
+#endif
+
 
 /***********************************************************
 *   SINH / COSH / TANH
 */
 
+#ifndef SINH_COSH_TANH_ENABLED
+#define SINH_COSH_TANH_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if SINH_COSH_TANH_ENABLED > 0
+
 // Address generation function parameters
+#ifndef SINH_COSH_TANH_PRECISION
 #define SINH_COSH_TANH_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
 
 // Storage
 #ifndef SINH_COSH_TANH_STORE_IN_WRAM
 #define SINH_COSH_TANH_STORE_IN_WRAM 0
 #endif
 
+#define SINH_TABLE_ID 1
+#if PACKED_TABLES > 0
+#define sinh_cosh_tanh_granularity_exponent PACKED_INT_PARAMETER(SINH_TABLE_ID)
+#else
 __host int sinh_cosh_tanh_granularity_exponent;
+#endif
+#ifdef SINH_COSH_TANH_GRANULARITY_EXPONENT_CONSTANT
+#undef sinh_cosh_tanh_granularity_exponent
+#define sinh_cosh_tanh_granularity_exponent SINH_COSH_TANH_GRANULARITY_EXPONENT_CONSTANT
+#endif
 
-#if SINH_COSH_TANH_STORE_IN_WRAM > 0
+#if SINH_COSH_TANH_STORE_IN_WRAM > 0 && PACKED_TABLES == 0
 __host float sinh_table[1 << SINH_COSH_TANH_PRECISION];
 #else
+#if PACKED_TABLES > 0
+#define sinh_table PACKED_TABLE(float, SINH_TABLE_ID)
+#else
 __mram_noinit float sinh_table[1 << SINH_COSH_TANH_PRECISION];
 #endif
+#endif
 
-#if SINH_COSH_TANH_STORE_IN_WRAM > 0
+#define COSH_TABLE_ID 2
+#if SINH_COSH_TANH_STORE_IN_WRAM > 0 && PACKED_TABLES == 0
 __host float cosh_table[1 << SINH_COSH_TANH_PRECISION];
 #else
+#if PACKED_TABLES > 0
+#define cosh_table PACKED_TABLE(float, COSH_TABLE_ID)
+#else
 __mram_noinit float cosh_table[1 << SINH_COSH_TANH_PRECISION];
 #endif
+#endif
 
 // Functions
-// TODO
+// tanh(x) is +-1 in float for |x| > 9.01, so larger inputs don't need a lookup
+#define TANH_SATURATION_BITS 0x41800000 // 16.0f
+
+// Helper Function: sinh(|x|) and cosh(|x|), abs_binary are the bits of |x| (see sinh_cosh_range_extension_out())
+static inline void sinh_cosh_abs(unsigned int abs_binary, int granularity_exponent, float *sinh_ret, float *cosh_ret) {
+    float x_abs = * ( float * ) &abs_binary;
+    #ifdef NOWRAP
+        int exponent_2pow_integer = 0;
+        int address = float_to_address_roundup_ldexpf(x_abs, granularity_exponent);
+    #else
+        int exponent_2pow_integer;
+        int address = float_to_address_roundup_ldexpf(exp_range_extension_in(x_abs, &exponent_2pow_integer), granularity_exponent);
+    #endif
+
+    *sinh_ret = sinh_table[address];
+    *cosh_ret = cosh_table[address];
+
+    sinh_cosh_range_extension_out(sinh_ret, cosh_ret, &exponent_2pow_integer);
+}
+
+static inline float sinhf_core(float x, int granularity_exponent) {
+    unsigned int in_binary = * ( unsigned int * ) &x;
+    float sinh_y, cosh_y;
+    sinh_cosh_abs(in_binary & FLOAT_EXPONENT_AND_MANTISSA_MASK, granularity_exponent, &sinh_y, &cosh_y);
+    return symmetry_odd(sinh_y, in_binary & FLOAT_SIGN_MASK);
+}
+
+float sinhf(float x) {
+    return sinhf_core(x, sinh_cosh_tanh_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void sinhf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    int granularity_exponent = sinh_cosh_tanh_granularity_exponent;
+    VECTOR_LOOP(float, in, out, n, x, sinhf_core(x, granularity_exponent));
+}
+#endif
+
+static inline float coshf_core(float x, int granularity_exponent) {
+    unsigned int in_binary = * ( unsigned int * ) &x;
+    float sinh_y, cosh_y;
+    sinh_cosh_abs(in_binary & FLOAT_EXPONENT_AND_MANTISSA_MASK, granularity_exponent, &sinh_y, &cosh_y);
+    return cosh_y;
+}
+
+float coshf(float x) {
+    return coshf_core(x, sinh_cosh_tanh_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void coshf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    int granularity_exponent = sinh_cosh_tanh_granularity_exponent;
+    VECTOR_LOOP(float, in, out, n, x, coshf_core(x, granularity_exponent));
+}
+#endif
+
+static inline float tanhf_core(float x, int granularity_exponent) {
+    unsigned int in_binary = * ( unsigned int * ) &x;
+    float y = 1.0f;
+    if ((in_binary & FLOAT_EXPONENT_AND_MANTISSA_MASK) < TANH_SATURATION_BITS) {
+        float sinh_y, cosh_y;
+        sinh_cosh_abs(in_binary & FLOAT_EXPONENT_AND_MANTISSA_MASK, granularity_exponent, &sinh_y, &cosh_y);
+        y = sinh_y / cosh_y;
+    }
+    return symmetry_odd(y, in_binary & FLOAT_SIGN_MASK);
+}
+
+float tanhf(float x) {
+    return tanhf_core(x, sinh_cosh_tanh_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void tanhf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    int granularity_exponent = sinh_cosh_tanh_granularity_exponent;
+    VECTOR_LOOP(float, in, out, n, x, tanhf_core(x, granularity_exponent));
+}
+#endif
+
+// sinh and cosh of the same input, with only one range reduction
+static inline void sinhcoshf_core(float x, int granularity_exponent, float *sinh_ret, float *cosh_ret) {
+    unsigned int in_binary = * ( unsigned int * ) &x;
+    sinh_cosh_abs(in_binary & FLOAT_EXPONENT_AND_MANTISSA_MASK, granularity_exponent, sinh_ret, cosh_ret);
+    *sinh_ret = symmetry_odd(*sinh_ret, in_binary & FLOAT_SIGN_MASK);
+}
+
+void sinhcoshf(float x, float *sinh_ret, float *cosh_ret) {
+    sinhcoshf_core(x, sinh_cosh_tanh_granularity_exponent, sinh_ret, cosh_ret);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void sinhcoshf_v(__mram_ptr const float *in, __mram_ptr float *out_sinh, __mram_ptr float *out_cosh, uint32_t n) {
+    int granularity_exponent = sinh_cosh_tanh_granularity_exponent;
+    VECTOR_LOOP_PAIR(float, in, out_sinh, out_cosh, n, x, sinh_y, cosh_y, sinhcoshf_core(x, granularity_exponent, sinh_y, cosh_y));
+}
+#endif
+
+#endif
 
 
 /***********************************************************
 *   EXP
 */
 
+#ifndef EXP_ENABLED
+#define EXP_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if EXP_ENABLED > 0
+
 // Address generation function parameters
+#ifndef EXP_PRECISION
 #define EXP_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
 
 // Storage
 #ifndef EXP_STORE_IN_WRAM
 #define EXP_STORE_IN_WRAM 0
 #endif
 
+#define EXP_TABLE_ID 3
+#if PACKED_TABLES > 0
+#define exp_granularity_exponent PACKED_INT_PARAMETER(EXP_TABLE_ID)
+#else
 __host int exp_granularity_exponent;
+#endif
+#ifdef EXP_GRANULARITY_EXPONENT_CONSTANT
+#undef exp_granularity_exponent
+#define exp_granularity_exponent EXP_GRANULARITY_EXPONENT_CONSTANT
+#endif
 
-#if EXP_STORE_IN_WRAM > 0
+#if EXP_STORE_IN_WRAM > 0 && PACKED_TABLES == 0
 __host float exp_table[1 << EXP_PRECISION];
 #else
+#if PACKED_TABLES > 0
+#define exp_table PACKED_TABLE(float, EXP_TABLE_ID)
+#else
 __mram_noinit float exp_table[1 << EXP_PRECISION];
 #endif
+#endif
 
 // Functions
-float expf (float x) {
+static inline float expf_core(float x, int granularity_exponent) {
     #ifdef NOWRAP
-        int offset_from_zero = float_to_address_roundup_ldexpf(x, exp_granularity_exponent);
+        int offset_from_zero = float_to_address_roundup_ldexpf(x, granularity_exponent);
         return exp_table[offset_from_zero];
     #else
         int extra_data;
-        int offset_from_zero = float_to_address_roundup_ldexpf(exp_range_extension_in(x, &extra_data), exp_granularity_exponent);
+        int offset_from_zero = float_to_address_roundup_ldexpf(exp_range_extension_in(x, &extra_data), granularity_exponent);
         return exp_range_extension_out(exp_table[offset_from_zero], &extra_data);
     #endif
 }
 
+float expf(float x) {
+    return expf_core(x, exp_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void expf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    int granularity_exponent = exp_granularity_exponent;
+    VECTOR_LOOP(float, in, out, n, x, expf_core(x, granularity_exponent));
+}
+#endif
+
+#endif
+
 
 /***********************************************************
 *   LOG
 */
 
+#ifndef LOG_ENABLED
+#define LOG_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if LOG_ENABLED > 0
+
 // Address generation function parameters
+#ifndef LOG_PRECISION
 #define LOG_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
 
 // Storage
 #ifndef LOG_STORE_IN_WRAM
 #define LOG_STORE_IN_WRAM 0
 #endif
 
+#define LOG_TABLE_ID 4
+#if PACKED_TABLES > 0
+#define log_granularity_exponent PACKED_INT_PARAMETER(LOG_TABLE_ID)
+#else
 __host int log_granularity_exponent;
+#endif
+#ifdef LOG_GRANULARITY_EXPONENT_CONSTANT
+#undef log_granularity_exponent
+#define log_granularity_exponent LOG_GRANULARITY_EXPONENT_CONSTANT
+#endif
 
-#if LOG_STORE_IN_WRAM > 0
+#if LOG_STORE_IN_WRAM > 0 && PACKED_TABLES == 0
 __host float log_table[1 << LOG_PRECISION];
 #else
+#if PACKED_TABLES > 0
+#define log_table PACKED_TABLE(float, LOG_TABLE_ID)
+#else
 __mram_noinit float log_table[1 << LOG_PRECISION];
 #endif
+#endif
 
 // Function
-float logf(float x) {
+static inline float logf_core(float x, int granularity_exponent) {
     #ifdef NOWRAP
-        int offset_from_zero = float_to_address_roundup_ldexpf(x, log_granularity_exponent);
+        int offset_from_zero = float_to_address_roundup_ldexpf(x, granularity_exponent);
         return log_table[offset_from_zero];
     #else
         int extra_data;
-        int offset_from_zero = float_to_address_roundup_ldexpf(log_range_extension_in(x, &extra_data), log_granularity_exponent);
+        int offset_from_zero = float_to_address_roundup_ldexpf(log_range_extension_in(x, &extra_data), granularity_exponent);
         return log_range_extension_out(log_table[offset_from_zero], &extra_data);
     #endif
 }
 
+float logf(float x) {
+    return logf_core(x, log_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void logf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    int granularity_exponent = log_granularity_exponent;
+    VECTOR_LOOP(float, in, out, n, x, logf_core(x, granularity_exponent));
+}
+#endif
+
+#endif
+
 
 /***********************************************************
 *   SQRT
 */
 
+#ifndef SQRT_ENABLED
+#define SQRT_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if SQRT_ENABLED > 0
+
 // Address generation function parameters
+#ifndef SQRT_PRECISION
 #define SQRT_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
 
 // Storage
 #ifndef SQRT_STORE_IN_WRAM
 #define SQRT_STORE_IN_WRAM 0
 #endif
 
+#define SQRT_TABLE_ID 5
+#if PACKED_TABLES > 0
+#define sqrt_granularity_exponent PACKED_INT_PARAMETER(SQRT_TABLE_ID)
+#else
 __host int sqrt_granularity_exponent;
+#endif
+#ifdef SQRT_GRANULARITY_EXPONENT_CONSTANT
+#undef sqrt_granularity_exponent
+#define sqrt_granularity_exponent SQRT_GRANULARITY_EXPONENT_CONSTANT
+#endif
 
-#if SQRT_STORE_IN_WRAM > 0
+#if SQRT_STORE_IN_WRAM > 0 && PACKED_TABLES == 0
 __host float sqrt_table[1 << SQRT_PRECISION];
 #else
+#if PACKED_TABLES > 0
+#define sqrt_table PACKED_TABLE(float, SQRT_TABLE_ID)
+#else
 __mram_noinit float sqrt_table[1 << SQRT_PRECISION];
 #endif
+#endif
 
 // Function
-float sqrtf (float x) {
+static inline float sqrtf_core(float x, int granularity_exponent) {
     #ifdef NOWRAP
-        int offset_from_zero = float_to_address_roundup_ldexpf(x, sqrt_granularity_exponent);
+        int offset_from_zero = float_to_address_roundup_ldexpf(x, granularity_exponent);
         return sqrt_table[offset_from_zero];
     #else
         int extra_data;
-        int offset_from_zero = float_to_address_roundup_ldexpf(sqrt_range_extension_in(x, &extra_data), sqrt_granularity_exponent);
+        int offset_from_zero = float_to_address_roundup_ldexpf(sqrt_range_extension_in(x, &extra_data), granularity_exponent);
         return sqrt_range_extension_out(sqrt_table[offset_from_zero], &extra_data);
     #endif
 }
+
+float sqrtf(float x) {
+    return sqrtf_core(x, sqrt_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void sqrtf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    int granularity_exponent = sqrt_granularity_exponent;
+    VECTOR_LOOP(float, in, out, n, x, sqrtf_core(x, granularity_exponent));
+}
+#endif
+
+#endif
@@ -1,5 +1,12 @@
 #include "_ldexpf.c"
 #include "_quadrants.c"
+#include "_symmetry.c"
+#include "_table_cache.c"
+#include "_packed_tables.c"
+#include "_compressed_tables.c"
+#include "_table_staging.c"
+#include "_vector.c"
+#include "_table_constants.c"
 
 #pragma ide diagnostic ignored "UnusedParameter"
 #pragma ide diagnostic ignored "UnusedLocalVariable"
@@ -9,20 +16,46 @@
 #define PRECISION 10 // This needs to match on CPU and DPU side!
 #endif
 
+// Functions that are compiled in (single ones can be switched with <NAME>_ENABLED)
+#ifndef ALL_FUNCTIONS_ENABLED
+#define ALL_FUNCTIONS_ENABLED 1 // This needs to match on CPU and DPU side!
+#endif
+
+/*
+ * With -D INTEGER_INTERPOLATION=1, the tables hold fixed point values (FIXED_FRACTION_BITS fractional bits)
+ * and the interpolation is done with integer operations only. Inputs are taken apart and results are put together
+ * with bit manipulations, so apart from the divisions of tanf / tanhf and the multiplications in the range extensions
+ * of expf / sinhf / coshf / tanhf, no software float operation is left. Inputs of logf and sqrtf need to be positive normal floats.
+ */
+#ifndef INTEGER_INTERPOLATION
+#define INTEGER_INTERPOLATION 0 // This needs to match on CPU and DPU side!
+#endif
+
+// With -D COMPRESSED_TABLES=1, the tables hold 16 bit residuals instead (see _compressed_tables.c)
+#if INTEGER_INTERPOLATION > 0
+#define TABLE_ENTRY int
+#elif COMPRESSED_TABLES > 0
+#define TABLE_ENTRY int16_t
+#else
+#define TABLE_ENTRY float
+#endif
+
 /******************************************************************************************************************
  * Basic Usage of Helper Functions:
  *
  * float address_with_decimals = float_to_roughaddress_ldexpf(x, table_exponent);
  * int lower_address = (int) address_with_decimals;
- * float base = table[lower_address];
- * return base + (table[lower_address + 1] - base) * (address_with_decimals - (float) lower_address);
+ * float base, delta;
+ * TABLE_DELTA(lower_address, base, delta);
+ * return base + delta * (address_with_decimals - (float) lower_address);
  *
  * OR
  *
  * unsigned int lower_address = fixed_to_address_ldexpf(x_fixed_point_offset, sin_cos_tan_granularity_exponent);
  * float diff = fixed_to_diff_ldexpf(x_fixed_point_offset, sin_cos_tan_granularity_exponent);
- * float base = table[lower_address];
- * return base + (table[lower_address + 1] - base) * diff;
+ * float base, delta;
+ * TABLE_DELTA(lower_address, base, delta);
+ * return base + delta * diff;
  */
 
 //Helper Function
@@ -40,253 +73,842 @@ static inline float fixed_to_diff_ldexpf(unsigned int x, int exponent) {
     return fixed_to_floating(x << ((FLOAT_TOTAL_BITS - FIXED_FRACTION_BITS) - exponent) >> (FLOAT_TOTAL_BITS - FIXED_FRACTION_BITS));
 }
 
+#if INTEGER_INTERPOLATION > 0
+/******************************************************************************************************************
+ * Basic Usage of Helper Functions for INTEGER_INTERPOLATION:
+ *
+ * unsigned int lower_address = fixed_to_address_ldexpf(x_fixed_point_offset, granularity_exponent);
+ * int diff = fixed_to_fixed_diff_ldexpf(x_fixed_point_offset, granularity_exponent);
+ * int base, delta;
+ * TABLE_DELTA(lower_address, base, delta);
+ * return fixed_to_floating_ldexpf(base + MULT(delta, diff), 0);
+ */
+
+// Looking at https://www.fefe.de/intof.html, casting the first part to long to not lose precision, then shifting and casting back
+#ifndef  MULT
+#define MULT(x, y) ((int)(((long)x * y) >> FIXED_FRACTION_BITS))
+#endif
+
+#define FIXED_ONE (1 << FIXED_FRACTION_BITS)
+#define FIXED_LN_2 ((int) (0.6931471805599453 * FIXED_ONE + 0.5))
+
+// The sum e * log(2) + log(m) of logf is done with fewer fractional bits, so that it can not overflow for any float exponent e
+#define LOG_SUM_SHIFT (FIXED_FRACTION_BITS - 24)
+#define LOG_SUM_LN_2 ((int) (0.6931471805599453 * (1 << 24) + 0.5))
+
+//Helper Function
+static inline int fixed_to_fixed_diff_ldexpf(unsigned int x, int exponent) {
+    return (x & ((1 << (FIXED_FRACTION_BITS + exponent)) - 1)) << -exponent;
+}
+
+//Helper Function: mantissa of a positive normal float in fixed point (in [1, 2)), the exponent is the one of frexpf()
+static inline unsigned int float_to_fixed_mantissa(float x, int *exponent) {
+    unsigned int in_binary = * ( unsigned int * ) &x;
+    *exponent = (int) (in_binary >> FLOAT_MANTISSA_BITS) - FLOAT_ZERO_EXPONENT;
+    return ((in_binary & FLOAT_MANTISSA_MASK) | FLOAT_OMITTED_BIT) << EXTRA_PRECISION;
+}
+
+//Helper Function: returns y * 2^exponent for a fixed point y, the result needs to be in the range of normal floats
+static inline float fixed_to_floating_ldexpf(int y, int exponent) {
+    return fixed_to_floating_fraction(y, FIXED_FRACTION_BITS - exponent);
+}
+#endif
+
 
 /***********************************************************
 *   SIN / COS / TAN
 */
 
+#ifndef SIN_COS_TAN_ENABLED
+#define SIN_COS_TAN_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if SIN_COS_TAN_ENABLED > 0
+
 // Address generation function parameters
+#ifndef SIN_COS_TAN_PRECISION
 #define SIN_COS_TAN_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
 
 // Storage
 #ifndef SIN_COS_TAN_STORE_IN_WRAM
 #define SIN_COS_TAN_STORE_IN_WRAM 0
 #endif
 
+#define SIN_COS_TAN_TABLE_ID 0
+#if PACKED_TABLES > 0
+#define sin_cos_tan_granularity_exponent PACKED_INT_PARAMETER(SIN_COS_TAN_TABLE_ID)
+#else
 __host int sin_cos_tan_granularity_exponent;
+#endif
+#ifdef SIN_COS_TAN_GRANULARITY_EXPONENT_CONSTANT
+#undef sin_cos_tan_granularity_exponent
+#define sin_cos_tan_granularity_exponent SIN_COS_TAN_GRANULARITY_EXPONENT_CONSTANT
+#endif
 
-#if SIN_COS_TAN_STORE_IN_WRAM > 0
-__host float sin_cos_tan_table[1 << SIN_COS_TAN_PRECISION];
+#if SIN_COS_TAN_STORE_IN_WRAM > 1 && PACKED_TABLES == 0
+STAGED_TABLE(TABLE_ENTRY, sin_cos_tan_table, TABLE_WORDS(1 << SIN_COS_TAN_PRECISION), 1 << SIN_COS_TAN_PRECISION)
+#define SIN_COS_TAN_TABLE_DELTA(index, base, delta) WRAM_TABLE_DELTA(sin_cos_tan_table_wram, SIN_COS_TAN_TABLE_ID, index, base, delta)
+#define SIN_COS_TAN_TABLE_STAGING STAGE_TABLE(sin_cos_tan_table)
+#elif SIN_COS_TAN_STORE_IN_WRAM > 0 && PACKED_TABLES == 0
+__host TABLE_ENTRY sin_cos_tan_table[TABLE_WORDS(1 << SIN_COS_TAN_PRECISION)];
+COMPRESSED_TABLE_BLOCKS(__host, sin_cos_tan_table, 1 << SIN_COS_TAN_PRECISION)
+#define SIN_COS_TAN_TABLE_DELTA(index, base, delta) WRAM_TABLE_DELTA(sin_cos_tan_table, SIN_COS_TAN_TABLE_ID, index, base, delta)
+#else
+#if PACKED_TABLES > 0
+#define sin_cos_tan_table PACKED_TABLE(TABLE_ENTRY, SIN_COS_TAN_TABLE_ID)
 #else
-__mram_noinit float sin_cos_tan_table[1 << SIN_COS_TAN_PRECISION];
+__mram_noinit TABLE_ENTRY sin_cos_tan_table[TABLE_WORDS(1 << SIN_COS_TAN_PRECISION)];
+COMPRESSED_TABLE_BLOCKS(__mram_noinit, sin_cos_tan_table, 1 << SIN_COS_TAN_PRECISION)
+#endif
+#define SIN_COS_TAN_TABLE_DELTA(index, base, delta) MRAM_TABLE_DELTA(sin_cos_tan_table, SIN_COS_TAN_TABLE_ID, index, base, delta)
 #endif
 
 // Functions
-float sinf(float x) {
+// Helper Function: table value at the reduced input (in the first quadrant)
+static inline float sin_cos_tan_interpolate(unsigned int x_fixed_point_offset, int granularity_exponent) {
+    unsigned int offset_addr_down = fixed_to_address_ldexpf(x_fixed_point_offset, granularity_exponent);
+
+#if INTEGER_INTERPOLATION > 0
+    int diff = fixed_to_fixed_diff_ldexpf(x_fixed_point_offset, granularity_exponent);
+
+    int base, delta;
+    SIN_COS_TAN_TABLE_DELTA(offset_addr_down, base, delta);
+    return fixed_to_floating_ldexpf(base + MULT(delta, diff), 0);
+#else
+    float diff = fixed_to_diff_ldexpf(x_fixed_point_offset, granularity_exponent);
+
+    float base, delta;
+    SIN_COS_TAN_TABLE_DELTA(offset_addr_down, base, delta);
+    return base + delta * diff;
+#endif
+}
+
+static inline float sinf_core(float x, int granularity_exponent) {
     int quadrant;
     unsigned int x_fixed_point_offset = sin_cos_tan_in(x, &quadrant);
-    unsigned int offset_addr_down = fixed_to_address_ldexpf(x_fixed_point_offset, sin_cos_tan_granularity_exponent);
+    return sin_float_out(sin_cos_tan_interpolate(x_fixed_point_offset, granularity_exponent), &quadrant);
+}
 
-    float diff = fixed_to_diff_ldexpf(x_fixed_point_offset, sin_cos_tan_granularity_exponent);
+float sinf(float x) {
+    return sinf_core(x, sin_cos_tan_granularity_exponent);
+}
 
-    float base = sin_cos_tan_table[offset_addr_down];
-    float y = base + (sin_cos_tan_table[offset_addr_down + 1] - base) * diff;
-    return sin_float_out(y, &quadrant);
+#if VECTOR_FUNCTIONS > 0
+void sinf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    int granularity_exponent = sin_cos_tan_granularity_exponent;
+    VECTOR_LOOP(float, in, out, n, x, sinf_core(x, granularity_exponent));
 }
+#endif
 
-float cosf(float x) {
+static inline float cosf_core(float x, int granularity_exponent) {
     int quadrant;
     unsigned int x_fixed_point_offset = cos_to_sin_in(x, &quadrant);
-    unsigned int offset_addr_down = fixed_to_address_ldexpf(x_fixed_point_offset, sin_cos_tan_granularity_exponent);
+    return sin_float_out(sin_cos_tan_interpolate(x_fixed_point_offset, granularity_exponent), &quadrant);
+}
 
-    float diff = fixed_to_diff_ldexpf(x_fixed_point_offset, sin_cos_tan_granularity_exponent);
+float cosf(float x) {
+    return cosf_core(x, sin_cos_tan_granularity_exponent);
+}
 
-    float base = sin_cos_tan_table[offset_addr_down];
-    float y = base + (sin_cos_tan_table[offset_addr_down + 1] - base) * diff;
-    return sin_float_out(y, &quadrant);
+#if VECTOR_FUNCTIONS > 0
+void cosf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    int granularity_exponent = sin_cos_tan_granularity_exponent;
+    VECTOR_LOOP(float, in, out, n, x, cosf_core(x, granularity_exponent));
 }
+#endif
 
-float tanf(float x) {
+static inline float tanf_core(float x, int granularity_exponent) {
     int quadrant;
+    unsigned int x_fixed_point_offset = sin_cos_tan_in(x, &quadrant);
 
-    unsigned int cos_x_fixed_point_offset = cos_to_sin_in(x, &quadrant);
-    unsigned int cos_addr_down = fixed_to_address_ldexpf(cos_x_fixed_point_offset, sin_cos_tan_granularity_exponent);
+    float sin_y = sin_cos_tan_interpolate(x_fixed_point_offset, granularity_exponent);
+    float cos_y = sin_cos_tan_interpolate(sin_to_cos_in(x_fixed_point_offset), granularity_exponent);
+    return tan_float_out(cos_y, sin_y, &quadrant);
+}
+
+float tanf(float x) {
+    return tanf_core(x, sin_cos_tan_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void tanf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    int granularity_exponent = sin_cos_tan_granularity_exponent;
+    VECTOR_LOOP(float, in, out, n, x, tanf_core(x, granularity_exponent));
+}
+#endif
 
-    unsigned int sin_x_fixed_point_offset = sin_cos_tan_in(x, &quadrant);
-    unsigned int sin_addr_down =  fixed_to_address_ldexpf(sin_x_fixed_point_offset, sin_cos_tan_granularity_exponent);
+// sin and cos of the same input, with only one range reduction
+static inline void sincosf_core(float x, int granularity_exponent, float *sin_ret, float *cos_ret) {
+    int quadrant;
+    unsigned int x_fixed_point_offset = sin_cos_tan_in(x, &quadrant);
 
-    float cos_diff = fixed_to_diff_ldexpf(cos_x_fixed_point_offset, sin_cos_tan_granularity_exponent);
-    float sin_diff = fixed_to_diff_ldexpf(sin_x_fixed_point_offset, sin_cos_tan_granularity_exponent);
+    *sin_ret = sin_float_out(sin_cos_tan_interpolate(x_fixed_point_offset, granularity_exponent), &quadrant);
+    *cos_ret = cos_float_out(sin_cos_tan_interpolate(sin_to_cos_in(x_fixed_point_offset), granularity_exponent), &quadrant);
+}
 
-    float cos_base = sin_cos_tan_table[cos_addr_down];
-    float cos_y = cos_base + (sin_cos_tan_table[cos_addr_down + 1] - cos_base) * cos_diff;
-    float sin_base = sin_cos_tan_table[sin_addr_down];
-    float sin_y = sin_base + (sin_cos_tan_table[sin_addr_down + 1] - sin_base) * sin_diff;
+void sincosf(float x, float *sin_ret, float *cos_ret) {
+    sincosf_core(x, sin_cos_tan_granularity_exponent, sin_ret, cos_ret);
+}
 
-    return tan_float_out(cos_y, sin_y, &quadrant);
+#if VECTOR_FUNCTIONS > 0
+void sincosf_v(__mram_ptr const float *in, __mram_ptr float *out_sin, __mram_ptr float *out_cos, uint32_t n) {
+    int granularity_exponent = sin_cos_tan_granularity_exponent;
+    VECTOR_LOOP_PAIR(float, in, out_sin, out_cos, n, x, sin_y, cos_y, sincosf_core(x, granularity_exponent, sin_y, cos_y));
 }
+#endif
+
+#endif
 
 
 /***********************************************************
 *   SINH / COSH / TANH
 */
 
+#ifndef SINH_COSH_TANH_ENABLED
+#define SINH_COSH_TANH_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if SINH_COSH_TANH_ENABLED > 0
+
 // Address generation function parameters
+#ifndef SINH_COSH_TANH_PRECISION
 #define SINH_COSH_TANH_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
 
 // Storage
 #ifndef SINH_COSH_TANH_STORE_IN_WRAM
 #define SINH_COSH_TANH_STORE_IN_WRAM 0
 #endif
 
+#define SINH_TABLE_ID 1
+#if PACKED_TABLES > 0
+#define sinh_cosh_tanh_granularity_exponent PACKED_INT_PARAMETER(SINH_TABLE_ID)
+#else
 __host int sinh_cosh_tanh_granularity_exponent;
+#endif
+#ifdef SINH_COSH_TANH_GRANULARITY_EXPONENT_CONSTANT
+#undef sinh_cosh_tanh_granularity_exponent
+#define sinh_cosh_tanh_granularity_exponent SINH_COSH_TANH_GRANULARITY_EXPONENT_CONSTANT
+#endif
 
-#if SINH_COSH_TANH_STORE_IN_WRAM > 0
-__host float sinh_table[1 << SINH_COSH_TANH_PRECISION];
+#if SINH_COSH_TANH_STORE_IN_WRAM > 1 && PACKED_TABLES == 0
+STAGED_TABLE(TABLE_ENTRY, sinh_table, TABLE_WORDS(1 << SINH_COSH_TANH_PRECISION), 1 << SINH_COSH_TANH_PRECISION)
+#define SINH_TABLE_DELTA(index, base, delta) WRAM_TABLE_DELTA(sinh_table_wram, SINH_TABLE_ID, index, base, delta)
+#define SINH_TABLE_STAGING STAGE_TABLE(sinh_table)
+#elif SINH_COSH_TANH_STORE_IN_WRAM > 0 && PACKED_TABLES == 0
+__host TABLE_ENTRY sinh_table[TABLE_WORDS(1 << SINH_COSH_TANH_PRECISION)];
+COMPRESSED_TABLE_BLOCKS(__host, sinh_table, 1 << SINH_COSH_TANH_PRECISION)
+#define SINH_TABLE_DELTA(index, base, delta) WRAM_TABLE_DELTA(sinh_table, SINH_TABLE_ID, index, base, delta)
+#else
+#if PACKED_TABLES > 0
+#define sinh_table PACKED_TABLE(TABLE_ENTRY, SINH_TABLE_ID)
 #else
-__mram_noinit float sinh_table[1 << SINH_COSH_TANH_PRECISION];
+__mram_noinit TABLE_ENTRY sinh_table[TABLE_WORDS(1 << SINH_COSH_TANH_PRECISION)];
+COMPRESSED_TABLE_BLOCKS(__mram_noinit, sinh_table, 1 << SINH_COSH_TANH_PRECISION)
+#endif
+#define SINH_TABLE_DELTA(index, base, delta) MRAM_TABLE_DELTA(sinh_table, SINH_TABLE_ID, index, base, delta)
 #endif
 
-#if SINH_COSH_TANH_STORE_IN_WRAM > 0
-__host float cosh_table[1 << SINH_COSH_TANH_PRECISION];
+#define COSH_TABLE_ID 2
+#if SINH_COSH_TANH_STORE_IN_WRAM > 1 && PACKED_TABLES == 0
+STAGED_TABLE(TABLE_ENTRY, cosh_table, TABLE_WORDS(1 << SINH_COSH_TANH_PRECISION), 1 << SINH_COSH_TANH_PRECISION)
+#define COSH_TABLE_DELTA(index, base, delta) WRAM_TABLE_DELTA(cosh_table_wram, COSH_TABLE_ID, index, base, delta)
+#define COSH_TABLE_STAGING STAGE_TABLE(cosh_table)
+#elif SINH_COSH_TANH_STORE_IN_WRAM > 0 && PACKED_TABLES == 0
+__host TABLE_ENTRY cosh_table[TABLE_WORDS(1 << SINH_COSH_TANH_PRECISION)];
+COMPRESSED_TABLE_BLOCKS(__host, cosh_table, 1 << SINH_COSH_TANH_PRECISION)
+#define COSH_TABLE_DELTA(index, base, delta) WRAM_TABLE_DELTA(cosh_table, COSH_TABLE_ID, index, base, delta)
+#else
+#if PACKED_TABLES > 0
+#define cosh_table PACKED_TABLE(TABLE_ENTRY, COSH_TABLE_ID)
 #else
-__mram_noinit float cosh_table[1 << SINH_COSH_TANH_PRECISION];
+__mram_noinit TABLE_ENTRY cosh_table[TABLE_WORDS(1 << SINH_COSH_TANH_PRECISION)];
+COMPRESSED_TABLE_BLOCKS(__mram_noinit, cosh_table, 1 << SINH_COSH_TANH_PRECISION)
+#endif
+#define COSH_TABLE_DELTA(index, base, delta) MRAM_TABLE_DELTA(cosh_table, COSH_TABLE_ID, index, base, delta)
 #endif
 
 // Functions
-// TODO
+// tanh(x) is +-1 in float for |x| > 9.01, so larger inputs don't need a lookup
+#define TANH_SATURATION_BITS 0x41800000 // 16.0f
+
+#if INTEGER_INTERPOLATION > 0
+// Helper Function: sinh(|x|) and cosh(|x|), abs_binary are the bits of |x| (see sinh_cosh_range_extension_out())
+static inline void sinh_cosh_abs(unsigned int abs_binary, int granularity_exponent, float *sinh_ret, float *cosh_ret) {
+    float x_abs = * ( float * ) &abs_binary;
+    #ifdef NOWRAP
+        int exponent_2pow_integer = 0;
+        unsigned int x_fixed_point_offset = floating_to_fixed(x_abs);
+    #else
+        // Same as exp_range_extension_in(), but the remainder stays in fixed point
+        int exponent_2pow_int = floating_to_fixed_exp_helper(x_abs * log2_e);
+        int exponent_2pow_integer = exponent_2pow_int >> FLOAT_MANTISSA_BITS;
+        int exponent_2pow_fractional_part = (exponent_2pow_int & FLOAT_MANTISSA_MASK) << EXTRA_PRECISION;
+        unsigned int x_fixed_point_offset = MULT(exponent_2pow_fractional_part, FIXED_LN_2);
+    #endif
+
+    unsigned int offset_addr_down = fixed_to_address_ldexpf(x_fixed_point_offset, granularity_exponent);
+    int diff = fixed_to_fixed_diff_ldexpf(x_fixed_point_offset, granularity_exponent);
+
+    int base, delta;
+    SINH_TABLE_DELTA(offset_addr_down, base, delta);
+    int sinh_y = base + MULT(delta, diff);
+    COSH_TABLE_DELTA(offset_addr_down, base, delta);
+    int cosh_y = base + MULT(delta, diff);
+
+    // Same as sinh_cosh_range_extension_out(), the factor 2^(k-1) is applied in the conversion to float
+    if (exponent_2pow_integer > 0) {
+        int exp_y = cosh_y + sinh_y;
+        int exp_minus_y = (cosh_y - sinh_y) >> (exponent_2pow_integer < 16 ? 2 * exponent_2pow_integer : 31);
+        sinh_y = exp_y - exp_minus_y;
+        cosh_y = exp_y + exp_minus_y;
+        exponent_2pow_integer -= 1;
+    }
+
+    *sinh_ret = fixed_to_floating_ldexpf(sinh_y, exponent_2pow_integer);
+    *cosh_ret = fixed_to_floating_ldexpf(cosh_y, exponent_2pow_integer);
+}
+#else
+// Helper Function: sinh(|x|) and cosh(|x|), abs_binary are the bits of |x| (see sinh_cosh_range_extension_out())
+static inline void sinh_cosh_abs(unsigned int abs_binary, int granularity_exponent, float *sinh_ret, float *cosh_ret) {
+    float x_abs = * ( float * ) &abs_binary;
+    #ifdef NOWRAP
+        int exponent_2pow_integer = 0;
+        float offset_float = float_to_roughaddress_ldexpf(x_abs, granularity_exponent);
+    #else
+        int exponent_2pow_integer;
+        float offset_float = float_to_roughaddress_ldexpf(exp_range_extension_in(x_abs, &exponent_2pow_integer), granularity_exponent);
+    #endif
+
+    int offset_addr_down = (int) offset_float;
+    float diff = offset_float - (float) offset_addr_down;
+
+    float base, delta;
+    SINH_TABLE_DELTA(offset_addr_down, base, delta);
+    *sinh_ret = base + delta * diff;
+    COSH_TABLE_DELTA(offset_addr_down, base, delta);
+    *cosh_ret = base + delta * diff;
+
+    sinh_cosh_range_extension_out(sinh_ret, cosh_ret, &exponent_2pow_integer);
+}
+#endif
+
+static inline float sinhf_core(float x, int granularity_exponent) {
+    unsigned int in_binary = * ( unsigned int * ) &x;
+    float sinh_y, cosh_y;
+    sinh_cosh_abs(in_binary & FLOAT_EXPONENT_AND_MANTISSA_MASK, granularity_exponent, &sinh_y, &cosh_y);
+    return symmetry_odd(sinh_y, in_binary & FLOAT_SIGN_MASK);
+}
+
+float sinhf(float x) {
+    return sinhf_core(x, sinh_cosh_tanh_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void sinhf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    int granularity_exponent = sinh_cosh_tanh_granularity_exponent;
+    VECTOR_LOOP(float, in, out, n, x, sinhf_core(x, granularity_exponent));
+}
+#endif
+
+static inline float coshf_core(float x, int granularity_exponent) {
+    unsigned int in_binary = * ( unsigned int * ) &x;
+    float sinh_y, cosh_y;
+    sinh_cosh_abs(in_binary & FLOAT_EXPONENT_AND_MANTISSA_MASK, granularity_exponent, &sinh_y, &cosh_y);
+    return cosh_y;
+}
+
+float coshf(float x) {
+    return coshf_core(x, sinh_cosh_tanh_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void coshf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    int granularity_exponent = sinh_cosh_tanh_granularity_exponent;
+    VECTOR_LOOP(float, in, out, n, x, coshf_core(x, granularity_exponent));
+}
+#endif
+
+static inline float tanhf_core(float x, int granularity_exponent) {
+    unsigned int in_binary = * ( unsigned int * ) &x;
+    float y = 1.0f;
+    if ((in_binary & FLOAT_EXPONENT_AND_MANTISSA_MASK) < TANH_SATURATION_BITS) {
+        float sinh_y, cosh_y;
+        sinh_cosh_abs(in_binary & FLOAT_EXPONENT_AND_MANTISSA_MASK, granularity_exponent, &sinh_y, &cosh_y);
+        y = sinh_y / cosh_y;
+    }
+    return symmetry_odd(y, in_binary & FLOAT_SIGN_MASK);
+}
+
+float tanhf(float x) {
+    return tanhf_core(x, sinh_cosh_tanh_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void tanhf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    int granularity_exponent = sinh_cosh_tanh_granularity_exponent;
+    VECTOR_LOOP(float, in, out, n, x, tanhf_core(x, granularity_exponent));
+}
+#endif
+
+// sinh and cosh of the same input, with only one range reduction
+static inline void sinhcoshf_core(float x, int granularity_exponent, float *sinh_ret, float *cosh_ret) {
+    unsigned int in_binary = * ( unsigned int * ) &x;
+    sinh_cosh_abs(in_binary & FLOAT_EXPONENT_AND_MANTISSA_MASK, granularity_exponent, sinh_ret, cosh_ret);
+    *sinh_ret = symmetry_odd(*sinh_ret, in_binary & FLOAT_SIGN_MASK);
+}
+
+void sinhcoshf(float x, float *sinh_ret, float *cosh_ret) {
+    sinhcoshf_core(x, sinh_cosh_tanh_granularity_exponent, sinh_ret, cosh_ret);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void sinhcoshf_v(__mram_ptr const float *in, __mram_ptr float *out_sinh, __mram_ptr float *out_cosh, uint32_t n) {
+    int granularity_exponent = sinh_cosh_tanh_granularity_exponent;
+    VECTOR_LOOP_PAIR(float, in, out_sinh, out_cosh, n, x, sinh_y, cosh_y, sinhcoshf_core(x, granularity_exponent, sinh_y, cosh_y));
+}
+#endif
+
+#endif
 
 
 /***********************************************************
 *   EXP
 */
 
+#ifndef EXP_ENABLED
+#define EXP_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if EXP_ENABLED > 0
+
 // Address generation function parameters
+#ifndef EXP_PRECISION
 #define EXP_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
 
 // Storage
 #ifndef EXP_STORE_IN_WRAM
 #define EXP_STORE_IN_WRAM 0
 #endif
 
+#define EXP_TABLE_ID 3
+#if PACKED_TABLES > 0
+#define exp_granularity_exponent PACKED_INT_PARAMETER(EXP_TABLE_ID)
+#else
 __host int exp_granularity_exponent;
+#endif
+#ifdef EXP_GRANULARITY_EXPONENT_CONSTANT
+#undef exp_granularity_exponent
+#define exp_granularity_exponent EXP_GRANULARITY_EXPONENT_CONSTANT
+#endif
 
-#if EXP_STORE_IN_WRAM > 0
-__host float exp_table[1 << EXP_PRECISION];
+#if EXP_STORE_IN_WRAM > 1 && PACKED_TABLES == 0
+STAGED_TABLE(TABLE_ENTRY, exp_table, TABLE_WORDS(1 << EXP_PRECISION), 1 << EXP_PRECISION)
+#define EXP_TABLE_DELTA(index, base, delta) WRAM_TABLE_DELTA(exp_table_wram, EXP_TABLE_ID, index, base, delta)
+#define EXP_TABLE_STAGING STAGE_TABLE(exp_table)
+#elif EXP_STORE_IN_WRAM > 0 && PACKED_TABLES == 0
+__host TABLE_ENTRY exp_table[TABLE_WORDS(1 << EXP_PRECISION)];
+COMPRESSED_TABLE_BLOCKS(__host, exp_table, 1 << EXP_PRECISION)
+#define EXP_TABLE_DELTA(index, base, delta) WRAM_TABLE_DELTA(exp_table, EXP_TABLE_ID, index, base, delta)
 #else
-__mram_noinit float exp_table[1 << EXP_PRECISION];
+#if PACKED_TABLES > 0
+#define exp_table PACKED_TABLE(TABLE_ENTRY, EXP_TABLE_ID)
+#else
+__mram_noinit TABLE_ENTRY exp_table[TABLE_WORDS(1 << EXP_PRECISION)];
+COMPRESSED_TABLE_BLOCKS(__mram_noinit, exp_table, 1 << EXP_PRECISION)
+#endif
+#define EXP_TABLE_DELTA(index, base, delta) MRAM_TABLE_DELTA(exp_table, EXP_TABLE_ID, index, base, delta)
 #endif
 
 // Functions
-float expf (float x) {
+#if INTEGER_INTERPOLATION > 0
+static inline float expf_core(float x, int granularity_exponent) {
     #ifdef NOWRAP
-        float offset_float = float_to_roughaddress_ldexpf(x, exp_granularity_exponent);
+        int exponent_2pow_integer = 0;
+        unsigned int x_fixed_point_offset = floating_to_fixed(x);
+    #else
+        // Same as exp_range_extension_in(), but the remainder stays in fixed point
+        int exponent_2pow_int = floating_to_fixed_exp_helper(x * log2_e);
+        int exponent_2pow_integer = exponent_2pow_int >> FLOAT_MANTISSA_BITS;
+        int exponent_2pow_fractional_part = (exponent_2pow_int & FLOAT_MANTISSA_MASK) << EXTRA_PRECISION;
+        unsigned int x_fixed_point_offset = MULT(exponent_2pow_fractional_part, FIXED_LN_2);
+    #endif
+
+    unsigned int offset_addr_down = fixed_to_address_ldexpf(x_fixed_point_offset, granularity_exponent);
+    int diff = fixed_to_fixed_diff_ldexpf(x_fixed_point_offset, granularity_exponent);
+
+    int base, delta;
+    EXP_TABLE_DELTA(offset_addr_down, base, delta);
+    return fixed_to_floating_ldexpf(base + MULT(delta, diff), exponent_2pow_integer);
+}
+#else
+static inline float expf_core(float x, int granularity_exponent) {
+    #ifdef NOWRAP
+        float offset_float = float_to_roughaddress_ldexpf(x, granularity_exponent);
     #else
         int extra_data;
-        float offset_float = float_to_roughaddress_ldexpf(exp_range_extension_in(x, &extra_data), exp_granularity_exponent);
+        float offset_float = float_to_roughaddress_ldexpf(exp_range_extension_in(x, &extra_data), granularity_exponent);
     #endif
 
     int offset_addr_down = (int) offset_float;
-    float base = exp_table[offset_addr_down];
+    float base, delta;
+    EXP_TABLE_DELTA(offset_addr_down, base, delta);
 
     #ifdef NOWRAP
-        return base + (exp_table[offset_addr_down + 1] - base) * (offset_float - (float) offset_addr_down);
+        return base + delta * (offset_float - (float) offset_addr_down);
     #else
-        return exp_range_extension_out(base + (exp_table[offset_addr_down + 1] - base) * (offset_float - (float) offset_addr_down), &extra_data);
+        return exp_range_extension_out(base + delta * (offset_float - (float) offset_addr_down), &extra_data);
     #endif
 }
+#endif
+
+float expf(float x) {
+    return expf_core(x, exp_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void expf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    int granularity_exponent = exp_granularity_exponent;
+    VECTOR_LOOP(float, in, out, n, x, expf_core(x, granularity_exponent));
+}
+#endif
+
+#endif
 
 
 /***********************************************************
 *   LOG
 */
 
+#ifndef LOG_ENABLED
+#define LOG_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if LOG_ENABLED > 0
+
 // Address generation function parameters
+#ifndef LOG_PRECISION
 #define LOG_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
 
 // Storage
 #ifndef LOG_STORE_IN_WRAM
 #define LOG_STORE_IN_WRAM 0
 #endif
 
+#define LOG_TABLE_ID 4
+#if PACKED_TABLES > 0
+#define log_granularity_exponent PACKED_INT_PARAMETER(LOG_TABLE_ID)
+#else
 __host int log_granularity_exponent;
+#endif
+#ifdef LOG_GRANULARITY_EXPONENT_CONSTANT
+#undef log_granularity_exponent
+#define log_granularity_exponent LOG_GRANULARITY_EXPONENT_CONSTANT
+#endif
 
-#if LOG_STORE_IN_WRAM > 0
-__host float log_table[1 << LOG_PRECISION];
+#if LOG_STORE_IN_WRAM > 1 && PACKED_TABLES == 0
+STAGED_TABLE(TABLE_ENTRY, log_table, TABLE_WORDS(1 << LOG_PRECISION), 1 << LOG_PRECISION)
+#define LOG_TABLE_DELTA(index, base, delta) WRAM_TABLE_DELTA(log_table_wram, LOG_TABLE_ID, index, base, delta)
+#define LOG_TABLE_STAGING STAGE_TABLE(log_table)
+#elif LOG_STORE_IN_WRAM > 0 && PACKED_TABLES == 0
+__host TABLE_ENTRY log_table[TABLE_WORDS(1 << LOG_PRECISION)];
+COMPRESSED_TABLE_BLOCKS(__host, log_table, 1 << LOG_PRECISION)
+#define LOG_TABLE_DELTA(index, base, delta) WRAM_TABLE_DELTA(log_table, LOG_TABLE_ID, index, base, delta)
+#else
+#if PACKED_TABLES > 0
+#define log_table PACKED_TABLE(TABLE_ENTRY, LOG_TABLE_ID)
 #else
-__mram_noinit float log_table[1 << LOG_PRECISION];
+__mram_noinit TABLE_ENTRY log_table[TABLE_WORDS(1 << LOG_PRECISION)];
+COMPRESSED_TABLE_BLOCKS(__mram_noinit, log_table, 1 << LOG_PRECISION)
+#endif
+#define LOG_TABLE_DELTA(index, base, delta) MRAM_TABLE_DELTA(log_table, LOG_TABLE_ID, index, base, delta)
 #endif
 
 // Function
-float logf (float x) {
+#if INTEGER_INTERPOLATION > 0
+static inline float logf_core(float x, int granularity_exponent) {
     #ifdef NOWRAP
-        float offset_float = float_to_roughaddress_ldexpf(x, log_granularity_exponent);
+        unsigned int x_fixed_point_offset = floating_to_fixed(x);
+    #else
+        int exponent;
+        unsigned int x_fixed_point_offset = float_to_fixed_mantissa(x, &exponent);
+    #endif
+
+    unsigned int base_address = fixed_to_address_ldexpf(x_fixed_point_offset, granularity_exponent);
+    int diff = fixed_to_fixed_diff_ldexpf(x_fixed_point_offset, granularity_exponent);
+
+    int base, delta;
+    LOG_TABLE_DELTA(base_address, base, delta);
+    int y = base + MULT(delta, diff);
+
+    #ifdef NOWRAP
+        return fixed_to_floating_ldexpf(y, 0);
+    #else
+        // Same as log_range_extension_out(), for exponent 0 all fractional bits are kept
+        return exponent == 0 ? fixed_to_floating_ldexpf(y, 0) : fixed_to_floating_ldexpf((y >> LOG_SUM_SHIFT) + exponent * LOG_SUM_LN_2, LOG_SUM_SHIFT);
+    #endif
+}
+#else
+static inline float logf_core(float x, int granularity_exponent) {
+    #ifdef NOWRAP
+        float offset_float = float_to_roughaddress_ldexpf(x, granularity_exponent);
     #else
         int extra_data;
-        float offset_float = float_to_roughaddress_ldexpf(log_range_extension_in(x, &extra_data), log_granularity_exponent);
+        float offset_float = float_to_roughaddress_ldexpf(log_range_extension_in(x, &extra_data), granularity_exponent);
     #endif
 
     int base_address = (int) offset_float;
-    float base = log_table[base_address];
+    float base, delta;
+    LOG_TABLE_DELTA(base_address, base, delta);
 
     #ifdef NOWRAP
-        return base + (log_table[base_address + 1] - base) * (offset_float - (float) base_address);
+        return base + delta * (offset_float - (float) base_address);
     #else
-        return log_range_extension_out(base + (log_table[base_address + 1] - base) * (offset_float - (float) base_address), &extra_data);
+        return log_range_extension_out(base + delta * (offset_float - (float) base_address), &extra_data);
     #endif
 }
+#endif
+
+float logf(float x) {
+    return logf_core(x, log_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void logf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    int granularity_exponent = log_granularity_exponent;
+    VECTOR_LOOP(float, in, out, n, x, logf_core(x, granularity_exponent));
+}
+#endif
+
+#endif
 
 
 /***********************************************************
 *   SQRT
 */
 
+#ifndef SQRT_ENABLED
+#define SQRT_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if SQRT_ENABLED > 0
+
 // Address generation function parameters
+#ifndef SQRT_PRECISION
 #define SQRT_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
 
 // Storage
 #ifndef SQRT_STORE_IN_WRAM
 #define SQRT_STORE_IN_WRAM 0
 #endif
 
+#define SQRT_TABLE_ID 5
+#if PACKED_TABLES > 0
+#define sqrt_granularity_exponent PACKED_INT_PARAMETER(SQRT_TABLE_ID)
+#else
 __host int sqrt_granularity_exponent;
+#endif
+#ifdef SQRT_GRANULARITY_EXPONENT_CONSTANT
+#undef sqrt_granularity_exponent
+#define sqrt_granularity_exponent SQRT_GRANULARITY_EXPONENT_CONSTANT
+#endif
 
-#if SQRT_STORE_IN_WRAM > 0
-__host float sqrt_table[1 << SQRT_PRECISION];
+#if SQRT_STORE_IN_WRAM > 1 && PACKED_TABLES == 0
+STAGED_TABLE(TABLE_ENTRY, sqrt_table, TABLE_WORDS(1 << SQRT_PRECISION), 1 << SQRT_PRECISION)
+#define SQRT_TABLE_DELTA(index, base, delta) WRAM_TABLE_DELTA(sqrt_table_wram, SQRT_TABLE_ID, index, base, delta)
+#define SQRT_TABLE_STAGING STAGE_TABLE(sqrt_table)
+#elif SQRT_STORE_IN_WRAM > 0 && PACKED_TABLES == 0
+__host TABLE_ENTRY sqrt_table[TABLE_WORDS(1 << SQRT_PRECISION)];
+COMPRESSED_TABLE_BLOCKS(__host, sqrt_table, 1 << SQRT_PRECISION)
+#define SQRT_TABLE_DELTA(index, base, delta) WRAM_TABLE_DELTA(sqrt_table, SQRT_TABLE_ID, index, base, delta)
 #else
-__mram_noinit float sqrt_table[1 << SQRT_PRECISION];
+#if PACKED_TABLES > 0
+#define sqrt_table PACKED_TABLE(TABLE_ENTRY, SQRT_TABLE_ID)
+#else
+__mram_noinit TABLE_ENTRY sqrt_table[TABLE_WORDS(1 << SQRT_PRECISION)];
+COMPRESSED_TABLE_BLOCKS(__mram_noinit, sqrt_table, 1 << SQRT_PRECISION)
+#endif
+#define SQRT_TABLE_DELTA(index, base, delta) MRAM_TABLE_DELTA(sqrt_table, SQRT_TABLE_ID, index, base, delta)
 #endif
 
 // Function
-float sqrtf (float x) {
+#if INTEGER_INTERPOLATION > 0
+static inline float sqrtf_core(float x, int granularity_exponent) {
     #ifdef NOWRAP
-        float offset_float = float_to_roughaddress_ldexpf(x, sqrt_granularity_exponent);
+        int exponent_even = 0;
+        unsigned int x_fixed_point_offset = floating_to_fixed(x);
+    #else
+        // Same as sqrt_range_extension_in(), the mantissa is in [1, 4) for an even exponent
+        int exponent_even;
+        unsigned int x_fixed_point_offset = float_to_fixed_mantissa(x, &exponent_even);
+        x_fixed_point_offset <<= exponent_even & 0x1;
+        exponent_even -= exponent_even & 0x1;
+    #endif
+
+    unsigned int offset_addr_down = fixed_to_address_ldexpf(x_fixed_point_offset, granularity_exponent);
+    int diff = fixed_to_fixed_diff_ldexpf(x_fixed_point_offset, granularity_exponent);
+
+    int base, delta;
+    SQRT_TABLE_DELTA(offset_addr_down, base, delta);
+    return fixed_to_floating_ldexpf(base + MULT(delta, diff), exponent_even >> 1);
+}
+#else
+static inline float sqrtf_core(float x, int granularity_exponent) {
+    #ifdef NOWRAP
+        float offset_float = float_to_roughaddress_ldexpf(x, granularity_exponent);
     #else
         int extra_data;
-        float offset_float = float_to_roughaddress_ldexpf(sqrt_range_extension_in(x, &extra_data), sqrt_granularity_exponent);
+        float offset_float = float_to_roughaddress_ldexpf(sqrt_range_extension_in(x, &extra_data), granularity_exponent);
     #endif
 
     int offset_addr_down = (int) offset_float;
-    float base = sqrt_table[offset_addr_down];
+    float base, delta;
+    SQRT_TABLE_DELTA(offset_addr_down, base, delta);
 
     #ifdef NOWRAP
-        return base + (sqrt_table[offset_addr_down + 1] - base) * (offset_float - (float) offset_addr_down);
+        return base + delta * (offset_float - (float) offset_addr_down);
     #else
-        return sqrt_range_extension_out(base + (sqrt_table[offset_addr_down + 1] - base) * (offset_float - (float) offset_addr_down), &extra_data);
+        return sqrt_range_extension_out(base + delta * (offset_float - (float) offset_addr_down), &extra_data);
     #endif
 }
+#endif
+
+float sqrtf(float x) {
+    return sqrtf_core(x, sqrt_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void sqrtf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    int granularity_exponent = sqrt_granularity_exponent;
+    VECTOR_LOOP(float, in, out, n, x, sqrtf_core(x, granularity_exponent));
+}
+#endif
+
+#endif
+
 
 /***********************************************************
 *   CNDF
 */
 
+#ifndef CNDF_ENABLED
+#define CNDF_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if CNDF_ENABLED > 0
+
 // Address generation function parameters
+#ifndef CNDF_PRECISION
 #define CNDF_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
 
 // Storage
 #ifndef CNDF_STORE_IN_WRAM
 #define CNDF_STORE_IN_WRAM 0
 #endif
 
+#define CNDF_TABLE_ID 6
+#if PACKED_TABLES > 0
+#define cndf_granularity_exponent PACKED_INT_PARAMETER(CNDF_TABLE_ID)
+#else
 __host int cndf_granularity_exponent;
+#endif
+#ifdef CNDF_GRANULARITY_EXPONENT_CONSTANT
+#undef cndf_granularity_exponent
+#define cndf_granularity_exponent CNDF_GRANULARITY_EXPONENT_CONSTANT
+#endif
 
-#if CNDF_STORE_IN_WRAM > 0
-__host int cndf_table[1 << SQRT_PRECISION];
+// The table holds cndf(-x) for x >= 0, cndf(x) is 1 - cndf(-x) (see _symmetry.c)
+#if CNDF_STORE_IN_WRAM > 1 && PACKED_TABLES == 0
+STAGED_TABLE(TABLE_ENTRY, cndf_table, TABLE_WORDS(1 << CNDF_PRECISION), 1 << CNDF_PRECISION)
+#define CNDF_TABLE_DELTA(index, base, delta) WRAM_TABLE_DELTA(cndf_table_wram, CNDF_TABLE_ID, index, base, delta)
+#define CNDF_TABLE_STAGING STAGE_TABLE(cndf_table)
+#elif CNDF_STORE_IN_WRAM > 0 && PACKED_TABLES == 0
+__host TABLE_ENTRY cndf_table[TABLE_WORDS(1 << CNDF_PRECISION)];
+COMPRESSED_TABLE_BLOCKS(__host, cndf_table, 1 << CNDF_PRECISION)
+#define CNDF_TABLE_DELTA(index, base, delta) WRAM_TABLE_DELTA(cndf_table, CNDF_TABLE_ID, index, base, delta)
 #else
-__mram_noinit int cndf_table[1 << SQRT_PRECISION];
+#if PACKED_TABLES > 0
+#define cndf_table PACKED_TABLE(TABLE_ENTRY, CNDF_TABLE_ID)
+#else
+__mram_noinit TABLE_ENTRY cndf_table[TABLE_WORDS(1 << CNDF_PRECISION)];
+COMPRESSED_TABLE_BLOCKS(__mram_noinit, cndf_table, 1 << CNDF_PRECISION)
+#endif
+#define CNDF_TABLE_DELTA(index, base, delta) MRAM_TABLE_DELTA(cndf_table, CNDF_TABLE_ID, index, base, delta)
 #endif
 
 // Function
-float cndf (float x) {
-    if (x > 0) {
-        float address_with_decimals = float_to_roughaddress_ldexpf(x, cndf_granularity_exponent);
-        int lower_address = (int) address_with_decimals;
-        float base = cndf_table[lower_address];
-        return 0.5f + base + (cndf_table[lower_address + 1] - base) * (address_with_decimals - (float) lower_address);
-    } else {
-        float address_with_decimals = float_to_roughaddress_ldexpf(-x, cndf_granularity_exponent);
-        int lower_address = (int) address_with_decimals;
-        float base = cndf_table[lower_address];
-        return 0.5f - base - (cndf_table[lower_address + 1] - base) * (address_with_decimals - (float) lower_address);
+#if INTEGER_INTERPOLATION > 0
+static inline float cndf_core(float x, int granularity_exponent) {
+    unsigned int sign;
+    float x_abs = symmetry_fold(x, &sign);
+    unsigned int x_abs_binary = * ( unsigned int * ) &x_abs;
+
+    // Inputs of 16 and above do not fit into the unsigned fixed point offset (and are far beyond the table)
+    if (x_abs_binary >= ((unsigned int) (FLOAT_ZERO_EXPONENT + 4) << FLOAT_MANTISSA_BITS)) {
+        return symmetry_complement(0.0f, sign);
     }
+
+    unsigned int x_fixed_point_offset = (unsigned int) floating_to_fixed(x_abs);
+    unsigned int lower_address = fixed_to_address_ldexpf(x_fixed_point_offset, granularity_exponent);
+    int diff = fixed_to_fixed_diff_ldexpf(x_fixed_point_offset, granularity_exponent);
+
+    int base, delta;
+    CNDF_TABLE_DELTA(lower_address, base, delta);
+    int y = base + MULT(delta, diff);
+    return fixed_to_floating_ldexpf(sign ? y : FIXED_ONE - y, 0);
+}
+#else
+static inline float cndf_core(float x, int granularity_exponent) {
+    unsigned int sign;
+    float address_with_decimals = float_to_roughaddress_ldexpf(symmetry_fold(x, &sign), granularity_exponent);
+    int lower_address = (int) address_with_decimals;
+    float base, delta;
+    CNDF_TABLE_DELTA(lower_address, base, delta);
+    return symmetry_complement(base + delta * (address_with_decimals - (float) lower_address), sign);
+}
+#endif
+
+float cndf(float x) {
+    return cndf_core(x, cndf_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void cndf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    int granularity_exponent = cndf_granularity_exponent;
+    VECTOR_LOOP(float, in, out, n, x, cndf_core(x, granularity_exponent));
+}
+#endif
+
+#endif
+
+// Copies the staged tables (<NAME>_STORE_IN_WRAM=2) into WRAM, needs to be called by all tasklets before the first lookup
+void table_staging() {
+    TABLE_STAGING_START();
+#ifdef SIN_COS_TAN_TABLE_STAGING
+    SIN_COS_TAN_TABLE_STAGING;
+#endif
+#ifdef SINH_TABLE_STAGING
+    SINH_TABLE_STAGING;
+#endif
+#ifdef COSH_TABLE_STAGING
+    COSH_TABLE_STAGING;
+#endif
+#ifdef EXP_TABLE_STAGING
+    EXP_TABLE_STAGING;
+#endif
+#ifdef LOG_TABLE_STAGING
+    LOG_TABLE_STAGING;
+#endif
+#ifdef SQRT_TABLE_STAGING
+    SQRT_TABLE_STAGING;
+#endif
+#ifdef CNDF_TABLE_STAGING
+    CNDF_TABLE_STAGING;
+#endif
+    TABLE_STAGING_END();
 }
@@ -0,0 +1,525 @@
+#include <mram.h>
+#include "_ldexpf.c"
+#include "_quadrants.c"
+#include "_symmetry.c"
+#include "_packed_tables.c"
+#include "_vector.c"
+#include "_table_constants.c"
+
+#pragma ide diagnostic ignored "UnusedParameter"
+#pragma ide diagnostic ignored "UnusedLocalVariable"
+#pragma ide diagnostic ignored "UnusedValue"
+
+/*
+ * Piecewise polynomial (spline) LUT: addressed like lut_ldexpf_interpolate.c, but every table entry is a segment
+ * that holds the coefficients of a quadratic or cubic polynomial instead of a single value
+ *
+ * Linear interpolation needs 2^14+ entries for an error around 1e-6, cubic segments reach that with 2^6 - 2^8 segments,
+ * so the tables fit into WRAM (which is the default here) and there is no MRAM access left in the hot path.
+ * The coefficients are fitted per segment on the host side (see host/lut_spline_host.c).
+ * PRECISION is the number of segments (as exponent of 2), SPLINE_DEGREE selects quadratic (2) or cubic (3) segments.
+ */
+
+#ifndef PRECISION
+#define PRECISION 6 // This needs to match on CPU and DPU side!
+#endif
+
+#ifndef SPLINE_DEGREE
+#define SPLINE_DEGREE 3 // This needs to match on CPU and DPU side!
+#endif
+
+// Floats per segment, also 4 for quadratic segments so that segments stay 8 byte aligned in MRAM
+#define SPLINE_STRIDE 4 // This needs to match on CPU and DPU side!
+
+// Functions that are compiled in (single ones can be switched with <NAME>_ENABLED)
+#ifndef ALL_FUNCTIONS_ENABLED
+#define ALL_FUNCTIONS_ENABLED 1 // This needs to match on CPU and DPU side!
+#endif
+
+/******************************************************************************************************************
+ * Basic Usage of Helper Functions:
+ *
+ * float address_with_decimals = float_to_roughaddress_ldexpf(x, table_exponent);
+ * int segment = (int) address_with_decimals;
+ * SEGMENT_BUFFER(buffer);
+ * return spline_evaluate(TABLE_SEGMENT(segment, buffer), address_with_decimals - (float) segment);
+ */
+
+//Helper Function
+static inline float float_to_roughaddress_ldexpf(float x, int exponent) {
+    return ldexpf(x, - exponent);
+}
+
+//Helper Function
+static inline unsigned int fixed_to_address_ldexpf(unsigned int x, int exponent) {
+    return x >> (FIXED_FRACTION_BITS + exponent);
+}
+
+//Helper Function
+static inline float fixed_to_diff_ldexpf(unsigned int x, int exponent) {
+    return fixed_to_floating(x << ((FLOAT_TOTAL_BITS - FIXED_FRACTION_BITS) - exponent) >> (FLOAT_TOTAL_BITS - FIXED_FRACTION_BITS));
+}
+
+//Helper Function: polynomial of a segment at t in [0, 1)
+static inline float spline_evaluate(const float *c, float t) {
+#if SPLINE_DEGREE > 2
+    return c[0] + t * (c[1] + t * (c[2] + t * c[3]));
+#else
+    return c[0] + t * (c[1] + t * c[2]);
+#endif
+}
+
+//Helper Function: copies a segment from MRAM to the (8 byte aligned) buffer
+static inline const float *spline_mram_segment(__mram_ptr const float *table, int index, float *buffer) {
+    mram_read(table + SPLINE_STRIDE * index, buffer, sizeof(float) * SPLINE_STRIDE);
+    return buffer;
+}
+
+/*
+ * Each table defines a <NAME>_TABLE_SEGMENT() that returns a pointer to the coefficients of a segment,
+ * for tables in WRAM directly into the table, for tables in MRAM into the buffer.
+ * <NAME>_SEGMENT_BUFFER() declares that buffer, which only tables in MRAM need
+ */
+#define WRAM_TABLE_SEGMENT(table, index, buffer) (&(table)[SPLINE_STRIDE * (index)])
+#define MRAM_TABLE_SEGMENT(table, index, buffer) spline_mram_segment(table, index, buffer)
+#define WRAM_SEGMENT_BUFFER(buffer)
+#define MRAM_SEGMENT_BUFFER(buffer) __dma_aligned float buffer[SPLINE_STRIDE]
+
+
+/***********************************************************
+*   SIN / COS / TAN
+*/
+
+#ifndef SIN_COS_TAN_ENABLED
+#define SIN_COS_TAN_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if SIN_COS_TAN_ENABLED > 0
+
+// Address generation function parameters
+#ifndef SIN_COS_TAN_PRECISION
+#define SIN_COS_TAN_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
+
+// Storage
+#ifndef SIN_COS_TAN_STORE_IN_WRAM
+#define SIN_COS_TAN_STORE_IN_WRAM 1
+#endif
+
+#define SIN_COS_TAN_TABLE_ID 0
+#if PACKED_TABLES > 0
+#define sin_cos_tan_granularity_exponent PACKED_INT_PARAMETER(SIN_COS_TAN_TABLE_ID)
+#else
+__host int sin_cos_tan_granularity_exponent;
+#endif
+#ifdef SIN_COS_TAN_GRANULARITY_EXPONENT_CONSTANT
+#undef sin_cos_tan_granularity_exponent
+#define sin_cos_tan_granularity_exponent SIN_COS_TAN_GRANULARITY_EXPONENT_CONSTANT
+#endif
+
+#if SIN_COS_TAN_STORE_IN_WRAM > 0 && PACKED_TABLES == 0
+__host float sin_cos_tan_table[SPLINE_STRIDE << SIN_COS_TAN_PRECISION];
+#define SIN_COS_TAN_TABLE_SEGMENT(index, buffer) WRAM_TABLE_SEGMENT(sin_cos_tan_table, index, buffer)
+#define SIN_COS_TAN_SEGMENT_BUFFER(buffer) WRAM_SEGMENT_BUFFER(buffer)
+#else
+#if PACKED_TABLES > 0
+#define sin_cos_tan_table PACKED_TABLE(float, SIN_COS_TAN_TABLE_ID)
+#else
+__mram_noinit float sin_cos_tan_table[SPLINE_STRIDE << SIN_COS_TAN_PRECISION];
+#endif
+#define SIN_COS_TAN_TABLE_SEGMENT(index, buffer) MRAM_TABLE_SEGMENT(sin_cos_tan_table, index, buffer)
+#define SIN_COS_TAN_SEGMENT_BUFFER(buffer) MRAM_SEGMENT_BUFFER(buffer)
+#endif
+
+// Functions
+// Helper Function: table value at the reduced input (in the first quadrant)
+static inline float sin_cos_tan_spline(unsigned int x_fixed_point_offset, int granularity_exponent) {
+    unsigned int segment = fixed_to_address_ldexpf(x_fixed_point_offset, granularity_exponent);
+    float diff = fixed_to_diff_ldexpf(x_fixed_point_offset, granularity_exponent);
+
+    SIN_COS_TAN_SEGMENT_BUFFER(buffer);
+    return spline_evaluate(SIN_COS_TAN_TABLE_SEGMENT(segment, buffer), diff);
+}
+
+static inline float sinf_core(float x, int granularity_exponent) {
+    int quadrant;
+    unsigned int x_fixed_point_offset = sin_cos_tan_in(x, &quadrant);
+    return sin_float_out(sin_cos_tan_spline(x_fixed_point_offset, granularity_exponent), &quadrant);
+}
+
+float sinf(float x) {
+    return sinf_core(x, sin_cos_tan_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void sinf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    int granularity_exponent = sin_cos_tan_granularity_exponent;
+    VECTOR_LOOP(float, in, out, n, x, sinf_core(x, granularity_exponent));
+}
+#endif
+
+static inline float cosf_core(float x, int granularity_exponent) {
+    int quadrant;
+    unsigned int x_fixed_point_offset = cos_to_sin_in(x, &quadrant);
+    return sin_float_out(sin_cos_tan_spline(x_fixed_point_offset, granularity_exponent), &quadrant);
+}
+
+float cosf(float x) {
+    return cosf_core(x, sin_cos_tan_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void cosf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    int granularity_exponent = sin_cos_tan_granularity_exponent;
+    VECTOR_LOOP(float, in, out, n, x, cosf_core(x, granularity_exponent));
+}
+#endif
+
+static inline float tanf_core(float x, int granularity_exponent) {
+    int quadrant;
+    unsigned int x_fixed_point_offset = sin_cos_tan_in(x, &quadrant);
+
+    float sin_y = sin_cos_tan_spline(x_fixed_point_offset, granularity_exponent);
+    float cos_y = sin_cos_tan_spline(sin_to_cos_in(x_fixed_point_offset), granularity_exponent);
+    return tan_float_out(cos_y, sin_y, &quadrant);
+}
+
+float tanf(float x) {
+    return tanf_core(x, sin_cos_tan_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void tanf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    int granularity_exponent = sin_cos_tan_granularity_exponent;
+    VECTOR_LOOP(float, in, out, n, x, tanf_core(x, granularity_exponent));
+}
+#endif
+
+// sin and cos of the same input, with only one range reduction
+static inline void sincosf_core(float x, int granularity_exponent, float *sin_ret, float *cos_ret) {
+    int quadrant;
+    unsigned int x_fixed_point_offset = sin_cos_tan_in(x, &quadrant);
+
+    *sin_ret = sin_float_out(sin_cos_tan_spline(x_fixed_point_offset, granularity_exponent), &quadrant);
+    *cos_ret = cos_float_out(sin_cos_tan_spline(sin_to_cos_in(x_fixed_point_offset), granularity_exponent), &quadrant);
+}
+
+void sincosf(float x, float *sin_ret, float *cos_ret) {
+    sincosf_core(x, sin_cos_tan_granularity_exponent, sin_ret, cos_ret);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void sincosf_v(__mram_ptr const float *in, __mram_ptr float *out_sin, __mram_ptr float *out_cos, uint32_t n) {
+    int granularity_exponent = sin_cos_tan_granularity_exponent;
+    VECTOR_LOOP_PAIR(float, in, out_sin, out_cos, n, x, sin_y, cos_y, sincosf_core(x, granularity_exponent, sin_y, cos_y));
+}
+#endif
+
+#endif
+
+
+/***********************************************************
+*   EXP
+*/
+
+#ifndef EXP_ENABLED
+#define EXP_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if EXP_ENABLED > 0
+
+// Address generation function parameters
+#ifndef EXP_PRECISION
+#define EXP_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
+
+// Storage
+#ifndef EXP_STORE_IN_WRAM
+#define EXP_STORE_IN_WRAM 1
+#endif
+
+#define EXP_TABLE_ID 3
+#if PACKED_TABLES > 0
+#define exp_granularity_exponent PACKED_INT_PARAMETER(EXP_TABLE_ID)
+#else
+__host int exp_granularity_exponent;
+#endif
+#ifdef EXP_GRANULARITY_EXPONENT_CONSTANT
+#undef exp_granularity_exponent
+#define exp_granularity_exponent EXP_GRANULARITY_EXPONENT_CONSTANT
+#endif
+
+#if EXP_STORE_IN_WRAM > 0 && PACKED_TABLES == 0
+__host float exp_table[SPLINE_STRIDE << EXP_PRECISION];
+#define EXP_TABLE_SEGMENT(index, buffer) WRAM_TABLE_SEGMENT(exp_table, index, buffer)
+#define EXP_SEGMENT_BUFFER(buffer) WRAM_SEGMENT_BUFFER(buffer)
+#else
+#if PACKED_TABLES > 0
+#define exp_table PACKED_TABLE(float, EXP_TABLE_ID)
+#else
+__mram_noinit float exp_table[SPLINE_STRIDE << EXP_PRECISION];
+#endif
+#define EXP_TABLE_SEGMENT(index, buffer) MRAM_TABLE_SEGMENT(exp_table, index, buffer)
+#define EXP_SEGMENT_BUFFER(buffer) MRAM_SEGMENT_BUFFER(buffer)
+#endif
+
+// Functions
+static inline float expf_core(float x, int granularity_exponent) {
+    #ifdef NOWRAP
+        float offset_float = float_to_roughaddress_ldexpf(x, granularity_exponent);
+    #else
+        int extra_data;
+        float offset_float = float_to_roughaddress_ldexpf(exp_range_extension_in(x, &extra_data), granularity_exponent);
+    #endif
+
+    int segment = (int) offset_float;
+    EXP_SEGMENT_BUFFER(buffer);
+    float y = spline_evaluate(EXP_TABLE_SEGMENT(segment, buffer), offset_float - (float) segment);
+
+    #ifdef NOWRAP
+        return y;
+    #else
+        return exp_range_extension_out(y, &extra_data);
+    #endif
+}
+
+float expf(float x) {
+    return expf_core(x, exp_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void expf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    int granularity_exponent = exp_granularity_exponent;
+    VECTOR_LOOP(float, in, out, n, x, expf_core(x, granularity_exponent));
+}
+#endif
+
+#endif
+
+
+/***********************************************************
+*   LOG
+*/
+
+#ifndef LOG_ENABLED
+#define LOG_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if LOG_ENABLED > 0
+
+// Address generation function parameters
+#ifndef LOG_PRECISION
+#define LOG_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
+
+// Storage
+#ifndef LOG_STORE_IN_WRAM
+#define LOG_STORE_IN_WRAM 1
+#endif
+
+#define LOG_TABLE_ID 4
+#if PACKED_TABLES > 0
+#define log_granularity_exponent PACKED_INT_PARAMETER(LOG_TABLE_ID)
+#else
+__host int log_granularity_exponent;
+#endif
+#ifdef LOG_GRANULARITY_EXPONENT_CONSTANT
+#undef log_granularity_exponent
+#define log_granularity_exponent LOG_GRANULARITY_EXPONENT_CONSTANT
+#endif
+
+#if LOG_STORE_IN_WRAM > 0 && PACKED_TABLES == 0
+__host float log_table[SPLINE_STRIDE << LOG_PRECISION];
+#define LOG_TABLE_SEGMENT(index, buffer) WRAM_TABLE_SEGMENT(log_table, index, buffer)
+#define LOG_SEGMENT_BUFFER(buffer) WRAM_SEGMENT_BUFFER(buffer)
+#else
+#if PACKED_TABLES > 0
+#define log_table PACKED_TABLE(float, LOG_TABLE_ID)
+#else
+__mram_noinit float log_table[SPLINE_STRIDE << LOG_PRECISION];
+#endif
+#define LOG_TABLE_SEGMENT(index, buffer) MRAM_TABLE_SEGMENT(log_table, index, buffer)
+#define LOG_SEGMENT_BUFFER(buffer) MRAM_SEGMENT_BUFFER(buffer)
+#endif
+
+// Function
+static inline float logf_core(float x, int granularity_exponent) {
+    #ifdef NOWRAP
+        float offset_float = float_to_roughaddress_ldexpf(x, granularity_exponent);
+    #else
+        int extra_data;
+        float offset_float = float_to_roughaddress_ldexpf(log_range_extension_in(x, &extra_data), granularity_exponent);
+    #endif
+
+    int segment = (int) offset_float;
+    LOG_SEGMENT_BUFFER(buffer);
+    float y = spline_evaluate(LOG_TABLE_SEGMENT(segment, buffer), offset_float - (float) segment);
+
+    #ifdef NOWRAP
+        return y;
+    #else
+        return log_range_extension_out(y, &extra_data);
+    #endif
+}
+
+float logf(float x) {
+    return logf_core(x, log_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void logf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    int granularity_exponent = log_granularity_exponent;
+    VECTOR_LOOP(float, in, out, n, x, logf_core(x, granularity_exponent));
+}
+#endif
+
+#endif
+
+
+/***********************************************************
+*   SQRT
+*/
+
+#ifndef SQRT_ENABLED
+#define SQRT_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if SQRT_ENABLED > 0
+
+// Address generation function parameters
+#ifndef SQRT_PRECISION
+#define SQRT_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
+
+// Storage
+#ifndef SQRT_STORE_IN_WRAM
+#define SQRT_STORE_IN_WRAM 1
+#endif
+
+#define SQRT_TABLE_ID 5
+#if PACKED_TABLES > 0
+#define sqrt_granularity_exponent PACKED_INT_PARAMETER(SQRT_TABLE_ID)
+#else
+__host int sqrt_granularity_exponent;
+#endif
+#ifdef SQRT_GRANULARITY_EXPONENT_CONSTANT
+#undef sqrt_granularity_exponent
+#define sqrt_granularity_exponent SQRT_GRANULARITY_EXPONENT_CONSTANT
+#endif
+
+#if SQRT_STORE_IN_WRAM > 0 && PACKED_TABLES == 0
+__host float sqrt_table[SPLINE_STRIDE << SQRT_PRECISION];
+#define SQRT_TABLE_SEGMENT(index, buffer) WRAM_TABLE_SEGMENT(sqrt_table, index, buffer)
+#define SQRT_SEGMENT_BUFFER(buffer) WRAM_SEGMENT_BUFFER(buffer)
+#else
+#if PACKED_TABLES > 0
+#define sqrt_table PACKED_TABLE(float, SQRT_TABLE_ID)
+#else
+__mram_noinit float sqrt_table[SPLINE_STRIDE << SQRT_PRECISION];
+#endif
+#define SQRT_TABLE_SEGMENT(index, buffer) MRAM_TABLE_SEGMENT(sqrt_table, index, buffer)
+#define SQRT_SEGMENT_BUFFER(buffer) MRAM_SEGMENT_BUFFER(buffer)
+#endif
+
+// Function
+static inline float sqrtf_core(float x, int granularity_exponent) {
+    #ifdef NOWRAP
+        float offset_float = float_to_roughaddress_ldexpf(x, granularity_exponent);
+    #else
+        int extra_data;
+        float offset_float = float_to_roughaddress_ldexpf(sqrt_range_extension_in(x, &extra_data), granularity_exponent);
+    #endif
+
+    int segment = (int) offset_float;
+    SQRT_SEGMENT_BUFFER(buffer);
+    float y = spline_evaluate(SQRT_TABLE_SEGMENT(segment, buffer), offset_float - (float) segment);
+
+    #ifdef NOWRAP
+        return y;
+    #else
+        return sqrt_range_extension_out(y, &extra_data);
+    #endif
+}
+
+float sqrtf(float x) {
+    return sqrtf_core(x, sqrt_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void sqrtf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    int granularity_exponent = sqrt_granularity_exponent;
+    VECTOR_LOOP(float, in, out, n, x, sqrtf_core(x, granularity_exponent));
+}
+#endif
+
+#endif
+
+
+/***********************************************************
+*   CNDF
+*/
+
+#ifndef CNDF_ENABLED
+#define CNDF_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if CNDF_ENABLED > 0
+
+// Address generation function parameters
+#ifndef CNDF_PRECISION
+#define CNDF_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
+
+// Storage
+#ifndef CNDF_STORE_IN_WRAM
+#define CNDF_STORE_IN_WRAM 1
+#endif
+
+#define CNDF_TABLE_ID 6
+#if PACKED_TABLES > 0
+#define cndf_granularity_exponent PACKED_INT_PARAMETER(CNDF_TABLE_ID)
+#else
+__host int cndf_granularity_exponent;
+#endif
+#ifdef CNDF_GRANULARITY_EXPONENT_CONSTANT
+#undef cndf_granularity_exponent
+#define cndf_granularity_exponent CNDF_GRANULARITY_EXPONENT_CONSTANT
+#endif
+
+// The table holds cndf(-x) for x >= 0, which keeps the relative precision of the tail
+#if CNDF_STORE_IN_WRAM > 0 && PACKED_TABLES == 0
+__host float cndf_table[SPLINE_STRIDE << CNDF_PRECISION];
+#define CNDF_TABLE_SEGMENT(index, buffer) WRAM_TABLE_SEGMENT(cndf_table, index, buffer)
+#define CNDF_SEGMENT_BUFFER(buffer) WRAM_SEGMENT_BUFFER(buffer)
+#else
+#if PACKED_TABLES > 0
+#define cndf_table PACKED_TABLE(float, CNDF_TABLE_ID)
+#else
+__mram_noinit float cndf_table[SPLINE_STRIDE << CNDF_PRECISION];
+#endif
+#define CNDF_TABLE_SEGMENT(index, buffer) MRAM_TABLE_SEGMENT(cndf_table, index, buffer)
+#define CNDF_SEGMENT_BUFFER(buffer) MRAM_SEGMENT_BUFFER(buffer)
+#endif
+
+// Function
+static inline float cndf_core(float x, int granularity_exponent) {
+    unsigned int sign;
+    float address_with_decimals = float_to_roughaddress_ldexpf(symmetry_fold(x, &sign), granularity_exponent);
+    int segment = (int) address_with_decimals;
+    CNDF_SEGMENT_BUFFER(buffer);
+    float y = spline_evaluate(CNDF_TABLE_SEGMENT(segment, buffer), address_with_decimals - (float) segment);
+    return symmetry_complement(y, sign);
+}
+
+float cndf(float x) {
+    return cndf_core(x, cndf_granularity_exponent);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void cndf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    int granularity_exponent = cndf_granularity_exponent;
+    VECTOR_LOOP(float, in, out, n, x, cndf_core(x, granularity_exponent));
+}
+#endif
+
+#endif
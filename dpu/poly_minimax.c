@@ -0,0 +1,294 @@
+#include "_ldexpf.c"
+#include "_quadrants.c"
+#include "_symmetry.c"
+#include "_polynomial.c"
+#include "_vector.c"
+
+#pragma ide diagnostic ignored "UnusedParameter"
+#pragma ide diagnostic ignored "UnusedLocalVariable"
+#pragma ide diagnostic ignored "UnusedValue"
+
+/*
+ * Polynomial method: every function is a minimax polynomial over its reduced input range
+ *
+ * The coefficients are fitted on the host side (see host/poly_minimax_host.c) and live in WRAM,
+ * (PRECISION + 1) floats per function instead of a table. PRECISION is the degree of the polynomials.
+ * The range extensions are the same as for the LUT methods.
+ */
+
+#ifndef PRECISION
+#define PRECISION 7 // This needs to match on CPU and DPU side!
+#endif
+
+// Functions that are compiled in (single ones can be switched with <NAME>_ENABLED)
+#ifndef ALL_FUNCTIONS_ENABLED
+#define ALL_FUNCTIONS_ENABLED 1 // This needs to match on CPU and DPU side!
+#endif
+
+#define CNDF_POLY_RANGE 5.0f // This needs to match on CPU and DPU side!
+
+// Number of pieces cndf is split into over [0, CNDF_POLY_RANGE] - could be externally defined
+#ifndef CNDF_POLY_PIECES
+#define CNDF_POLY_PIECES 5 // This needs to match on CPU and DPU side!
+#endif
+
+
+/***********************************************************
+*   SIN / COS / TAN
+*/
+
+#ifndef SIN_COS_TAN_ENABLED
+#define SIN_COS_TAN_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if SIN_COS_TAN_ENABLED > 0
+
+// Degree of the polynomial
+#ifndef SIN_COS_TAN_PRECISION
+#define SIN_COS_TAN_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
+
+// sin(x) for x in [0, PI / 2]
+__host float sin_cos_tan_coefficients[SIN_COS_TAN_PRECISION + 1];
+
+// Functions
+static inline float sinf_core(float x) {
+    int quadrant;
+    float sin_y = poly_float(sin_cos_tan_coefficients, SIN_COS_TAN_PRECISION, sin_cos_tan_in_float(x, &quadrant));
+    return sin_float_out(sin_y, &quadrant);
+}
+
+float sinf(float x) {
+    return sinf_core(x);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void sinf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    VECTOR_LOOP(float, in, out, n, x, sinf_core(x));
+}
+#endif
+
+static inline float cosf_core(float x) {
+    int quadrant;
+    float cos_y = poly_float(sin_cos_tan_coefficients, SIN_COS_TAN_PRECISION, sin_cos_tan_in_float(x + (float) (M_PI * 0.5), &quadrant));
+    return sin_float_out(cos_y, &quadrant);
+}
+
+float cosf(float x) {
+    return cosf_core(x);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void cosf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    VECTOR_LOOP(float, in, out, n, x, cosf_core(x));
+}
+#endif
+
+static inline float tanf_core(float x) {
+    int quadrant;
+    float x_reduced = sin_cos_tan_in_float(x, &quadrant);
+    float cos_y = poly_float(sin_cos_tan_coefficients, SIN_COS_TAN_PRECISION, sin_to_cos_in_float(x_reduced));
+    float sin_y = poly_float(sin_cos_tan_coefficients, SIN_COS_TAN_PRECISION, x_reduced);
+    return tan_float_out(cos_y, sin_y, &quadrant);
+}
+
+float tanf(float x) {
+    return tanf_core(x);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void tanf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    VECTOR_LOOP(float, in, out, n, x, tanf_core(x));
+}
+#endif
+
+// sin and cos of the same input, with only one range reduction
+static inline void sincosf_core(float x, float *sin_ret, float *cos_ret) {
+    int quadrant;
+    float x_reduced = sin_cos_tan_in_float(x, &quadrant);
+    *sin_ret = sin_float_out(poly_float(sin_cos_tan_coefficients, SIN_COS_TAN_PRECISION, x_reduced), &quadrant);
+    *cos_ret = cos_float_out(poly_float(sin_cos_tan_coefficients, SIN_COS_TAN_PRECISION, sin_to_cos_in_float(x_reduced)), &quadrant);
+}
+
+void sincosf(float x, float *sin_ret, float *cos_ret) {
+    sincosf_core(x, sin_ret, cos_ret);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void sincosf_v(__mram_ptr const float *in, __mram_ptr float *out_sin, __mram_ptr float *out_cos, uint32_t n) {
+    VECTOR_LOOP_PAIR(float, in, out_sin, out_cos, n, x, sin_y, cos_y, sincosf_core(x, sin_y, cos_y));
+}
+#endif
+
+#endif
+
+
+/***********************************************************
+*   EXP
+*/
+
+#ifndef EXP_ENABLED
+#define EXP_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if EXP_ENABLED > 0
+
+// Degree of the polynomial
+#ifndef EXP_PRECISION
+#define EXP_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
+
+// exp(x) for x in [0, log(2)]
+__host float exp_coefficients[EXP_PRECISION + 1];
+
+// Functions
+static inline float expf_core(float x) {
+    #ifdef NOWRAP
+        return poly_float(exp_coefficients, EXP_PRECISION, x);
+    #else
+        int extra_data;
+        float y = poly_float(exp_coefficients, EXP_PRECISION, exp_range_extension_in(x, &extra_data));
+        return exp_range_extension_out(y, &extra_data);
+    #endif
+}
+
+float expf(float x) {
+    return expf_core(x);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void expf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    VECTOR_LOOP(float, in, out, n, x, expf_core(x));
+}
+#endif
+
+#endif
+
+
+/***********************************************************
+*   LOG
+*/
+
+#ifndef LOG_ENABLED
+#define LOG_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if LOG_ENABLED > 0
+
+// Degree of the polynomial
+#ifndef LOG_PRECISION
+#define LOG_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
+
+// log(1 + t) for t in [0, 1] (or [-0.5, 1] with NOWRAP)
+__host float log_coefficients[LOG_PRECISION + 1];
+
+// Function
+static inline float logf_core(float x) {
+    #ifdef NOWRAP
+        return poly_float(log_coefficients, LOG_PRECISION, x - 1.0f);
+    #else
+        int extra_data;
+        float y = poly_float(log_coefficients, LOG_PRECISION, log_range_extension_in(x, &extra_data) - 1.0f);
+        return log_range_extension_out(y, &extra_data);
+    #endif
+}
+
+float logf(float x) {
+    return logf_core(x);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void logf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    VECTOR_LOOP(float, in, out, n, x, logf_core(x));
+}
+#endif
+
+#endif
+
+
+/***********************************************************
+*   SQRT
+*/
+
+#ifndef SQRT_ENABLED
+#define SQRT_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if SQRT_ENABLED > 0
+
+// Degree of the polynomial
+#ifndef SQRT_PRECISION
+#define SQRT_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
+
+// sqrt(1 + t) for t in [0, 3] (or [-0.5, 1] with NOWRAP)
+__host float sqrt_coefficients[SQRT_PRECISION + 1];
+
+// Function
+static inline float sqrtf_core(float x) {
+    #ifdef NOWRAP
+        return poly_float(sqrt_coefficients, SQRT_PRECISION, x - 1.0f);
+    #else
+        int extra_data;
+        float y = poly_float(sqrt_coefficients, SQRT_PRECISION, sqrt_range_extension_in(x, &extra_data) - 1.0f);
+        return sqrt_range_extension_out(y, &extra_data);
+    #endif
+}
+
+float sqrtf(float x) {
+    return sqrtf_core(x);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void sqrtf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    VECTOR_LOOP(float, in, out, n, x, sqrtf_core(x));
+}
+#endif
+
+#endif
+
+
+/***********************************************************
+*   CNDF
+*/
+
+#ifndef CNDF_ENABLED
+#define CNDF_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if CNDF_ENABLED > 0
+
+// Degree of the polynomial
+#ifndef CNDF_PRECISION
+#define CNDF_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
+
+// cndf(-x) piecewise: piece i holds cndf(-(i + u) * CNDF_POLY_RANGE / CNDF_POLY_PIECES) for u in [0, 1], beyond that cndf is taken as 0 or 1
+__host float cndf_coefficients[CNDF_POLY_PIECES][CNDF_PRECISION + 1];
+
+// Function
+static inline float cndf_core(float x) {
+    unsigned int sign;
+    float x_abs = symmetry_fold(x, &sign);
+    float y = 0.0f;
+    if (x_abs < CNDF_POLY_RANGE) {
+        float u = x_abs * (CNDF_POLY_PIECES / CNDF_POLY_RANGE);
+        int piece = (int) u;
+        piece = piece < CNDF_POLY_PIECES ? piece : CNDF_POLY_PIECES - 1; // Rounding of the scale
+        y = poly_float(cndf_coefficients[piece], CNDF_PRECISION, u - (float) piece);
+    }
+    return symmetry_complement(y, sign);
+}
+
+float cndf(float x) {
+    return cndf_core(x);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void cndf_v(__mram_ptr const float *in, __mram_ptr float *out, uint32_t n) {
+    VECTOR_LOOP(float, in, out, n, x, cndf_core(x));
+}
+#endif
+
+#endif
@@ -0,0 +1,313 @@
+#include <stdint.h>
+#include "_quadrants_fixed.c"
+#include "_symmetry_fixed.c"
+#include "_polynomial.c"
+#include "_vector.c"
+
+#pragma ide diagnostic ignored "UnusedParameter"
+#pragma ide diagnostic ignored "UnusedLocalVariable"
+#pragma ide diagnostic ignored "UnusedValue"
+
+/*
+ * Fixed point version of the polynomial method (poly_minimax.c), inputs and outputs have FIXED_FRACTION_BITS fractional bits
+ *
+ * Everything is done with integer operations, so on DPUs (which have no FPU) this is the cheapest way to get a function value.
+ * The host side needs -D POLY_MINIMAX_FIXED and the same FIXED_FRACTION_BITS, so the coefficients are sent as fixed point numbers.
+ * Inputs of sini / cosi / tani are expected in [0, 2.5 * PI] (like for lut_fixed.c), the other functions take any input.
+ */
+
+#ifndef PRECISION
+#define PRECISION 7 // This needs to match on CPU and DPU side!
+#endif
+
+// Functions that are compiled in (single ones can be switched with <NAME>_ENABLED)
+#ifndef ALL_FUNCTIONS_ENABLED
+#define ALL_FUNCTIONS_ENABLED 1 // This needs to match on CPU and DPU side!
+#endif
+
+#define CNDF_POLY_RANGE 5 // This needs to match on CPU and DPU side!
+
+// Number of pieces cndf is split into over [0, CNDF_POLY_RANGE] - could be externally defined
+#ifndef CNDF_POLY_PIECES
+#define CNDF_POLY_PIECES 5 // This needs to match on CPU and DPU side!
+#endif
+
+#define POLY_FIXED_ONE (1 << FIXED_FRACTION_BITS)
+#define POLY_FIXED_LOG2_E ((int32_t) (1.4426950408889634 * POLY_FIXED_ONE + 0.5))
+#define POLY_FIXED_LN_2 ((int32_t) (0.6931471805599453 * POLY_FIXED_ONE + 0.5))
+#define POLY_FIXED_SQRT_CENTER ((int32_t) (2.5 * POLY_FIXED_ONE)) // Middle of the mantissa range of sqrt
+#define POLY_FIXED_CNDF_SCALE ((int32_t) ((double) CNDF_POLY_PIECES / CNDF_POLY_RANGE * POLY_FIXED_ONE + 0.5))
+
+// Helper Function: position of the highest set bit relative to the fixed point one (x needs to be positive)
+static inline int fixed_exponent(int32_t x) {
+    return 31 - __builtin_clz((uint32_t) x) - FIXED_FRACTION_BITS;
+}
+
+
+/***********************************************************
+*   SIN / COS / TAN
+*/
+
+#ifndef SIN_COS_TAN_ENABLED
+#define SIN_COS_TAN_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if SIN_COS_TAN_ENABLED > 0
+
+// Degree of the polynomial
+#ifndef SIN_COS_TAN_PRECISION
+#define SIN_COS_TAN_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
+
+// Estrin needs x^8 above degree 7: (PI / 2)^8 = 37 only fits with FIXED_FRACTION_BITS <= 25
+#if POLY_ESTRIN > 0 && SIN_COS_TAN_PRECISION > 7 && FIXED_FRACTION_BITS > 25
+#error "Estrin's scheme overflows for sini / cosi / tani with a degree above 7 and more than 25 fractional bits"
+#endif
+
+// sin(x) for x in [0, PI / 2]
+__host int32_t sin_cos_tan_coefficients[SIN_COS_TAN_PRECISION + 1];
+
+// Functions
+static inline int sini_core(int x) {
+    int quadrant;
+    int sin_y = poly_fixed(sin_cos_tan_coefficients, SIN_COS_TAN_PRECISION, sin_cos_tan_in(x, &quadrant));
+    return sin_out(sin_y, &quadrant);
+}
+
+int sini(int x) {
+    return sini_core(x);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void sini_v(__mram_ptr const int *in, __mram_ptr int *out, uint32_t n) {
+    VECTOR_LOOP(int, in, out, n, x, sini_core(x));
+}
+#endif
+
+static inline int cosi_core(int x) {
+    int quadrant;
+    int cos_y = poly_fixed(sin_cos_tan_coefficients, SIN_COS_TAN_PRECISION, cos_to_sin_in(x, &quadrant));
+    return sin_out(cos_y, &quadrant);
+}
+
+int cosi(int x) {
+    return cosi_core(x);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void cosi_v(__mram_ptr const int *in, __mram_ptr int *out, uint32_t n) {
+    VECTOR_LOOP(int, in, out, n, x, cosi_core(x));
+}
+#endif
+
+static inline int tani_core(int x) {
+    int quadrant;
+    int x_reduced = sin_cos_tan_in(x, &quadrant);
+    int cos_y = poly_fixed(sin_cos_tan_coefficients, SIN_COS_TAN_PRECISION, sin_to_cos_in(x_reduced));
+    int sin_y = poly_fixed(sin_cos_tan_coefficients, SIN_COS_TAN_PRECISION, x_reduced);
+    return tan_out(cos_y, sin_y, &quadrant);
+}
+
+int tani(int x) {
+    return tani_core(x);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void tani_v(__mram_ptr const int *in, __mram_ptr int *out, uint32_t n) {
+    VECTOR_LOOP(int, in, out, n, x, tani_core(x));
+}
+#endif
+
+// sin and cos of the same input, with only one range reduction
+static inline void sincosi_core(int x, int *sin_ret, int *cos_ret) {
+    int quadrant;
+    int x_reduced = sin_cos_tan_in(x, &quadrant);
+    *sin_ret = sin_out(poly_fixed(sin_cos_tan_coefficients, SIN_COS_TAN_PRECISION, x_reduced), &quadrant);
+    *cos_ret = cos_out(poly_fixed(sin_cos_tan_coefficients, SIN_COS_TAN_PRECISION, sin_to_cos_in(x_reduced)), &quadrant);
+}
+
+void sincosi(int x, int *sin_ret, int *cos_ret) {
+    sincosi_core(x, sin_ret, cos_ret);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void sincosi_v(__mram_ptr const int *in, __mram_ptr int *out_sin, __mram_ptr int *out_cos, uint32_t n) {
+    VECTOR_LOOP_PAIR(int, in, out_sin, out_cos, n, x, sin_y, cos_y, sincosi_core(x, sin_y, cos_y));
+}
+#endif
+
+#endif
+
+
+/***********************************************************
+*   EXP
+*/
+
+#ifndef EXP_ENABLED
+#define EXP_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if EXP_ENABLED > 0
+
+// Degree of the polynomial
+#ifndef EXP_PRECISION
+#define EXP_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
+
+// exp(x) for x in [0, log(2)]
+__host int32_t exp_coefficients[EXP_PRECISION + 1];
+
+// Functions: exp(x) = 2^k * exp(r) with x = k * log(2) + r
+static inline int expi_core(int x) {
+    int32_t x_log2 = POLY_MULT(x, POLY_FIXED_LOG2_E);
+    int k = x_log2 >> FIXED_FRACTION_BITS;
+    int32_t r = POLY_MULT(x_log2 & (POLY_FIXED_ONE - 1), POLY_FIXED_LN_2);
+
+    int32_t y = poly_fixed(exp_coefficients, EXP_PRECISION, r);
+    return k >= 0 ? y << k : y >> -k;
+}
+
+int expi(int x) {
+    return expi_core(x);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void expi_v(__mram_ptr const int *in, __mram_ptr int *out, uint32_t n) {
+    VECTOR_LOOP(int, in, out, n, x, expi_core(x));
+}
+#endif
+
+#endif
+
+
+/***********************************************************
+*   LOG
+*/
+
+#ifndef LOG_ENABLED
+#define LOG_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if LOG_ENABLED > 0
+
+// Degree of the polynomial
+#ifndef LOG_PRECISION
+#define LOG_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
+
+// log(1 + t) for t in [0, 1]
+__host int32_t log_coefficients[LOG_PRECISION + 1];
+
+// Function: log(x) = e * log(2) + log(m) with x = 2^e * m and m in [1, 2), returns INT32_MIN for x <= 0
+static inline int logi_core(int x) {
+    if (x <= 0) {
+        return INT32_MIN;
+    }
+    int e = fixed_exponent(x);
+    int32_t m = e >= 0 ? x >> e : x << -e;
+    return poly_fixed(log_coefficients, LOG_PRECISION, m - POLY_FIXED_ONE) + e * POLY_FIXED_LN_2;
+}
+
+int logi(int x) {
+    return logi_core(x);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void logi_v(__mram_ptr const int *in, __mram_ptr int *out, uint32_t n) {
+    VECTOR_LOOP(int, in, out, n, x, logi_core(x));
+}
+#endif
+
+#endif
+
+
+/***********************************************************
+*   SQRT
+*/
+
+#ifndef SQRT_ENABLED
+#define SQRT_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if SQRT_ENABLED > 0
+
+// Degree of the polynomial
+#ifndef SQRT_PRECISION
+#define SQRT_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
+
+// Estrin needs t^8 above degree 7: 1.5^8 = 25.6 only fits with FIXED_FRACTION_BITS <= 26
+#if POLY_ESTRIN > 0 && SQRT_PRECISION > 7 && FIXED_FRACTION_BITS > 26
+#error "Estrin's scheme overflows for sqrti with a degree above 7 and more than 26 fractional bits"
+#endif
+
+// sqrt(2.5 + t) for t in [-1.5, 1.5], centred so that the powers of t stay small
+__host int32_t sqrt_coefficients[SQRT_PRECISION + 1];
+
+// Function: sqrt(x) = 2^(e / 2) * sqrt(m) with x = 2^e * m, e even and m in [1, 4)
+static inline int sqrti_core(int x) {
+    if (x <= 0) {
+        return 0;
+    }
+    int e = fixed_exponent(x) & ~1;
+    int32_t m = e >= 0 ? x >> e : x << -e;
+    int32_t y = poly_fixed(sqrt_coefficients, SQRT_PRECISION, m - POLY_FIXED_SQRT_CENTER);
+    return e >= 0 ? y << (e >> 1) : y >> (-e >> 1);
+}
+
+int sqrti(int x) {
+    return sqrti_core(x);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void sqrti_v(__mram_ptr const int *in, __mram_ptr int *out, uint32_t n) {
+    VECTOR_LOOP(int, in, out, n, x, sqrti_core(x));
+}
+#endif
+
+#endif
+
+
+/***********************************************************
+*   CNDF
+*/
+
+#ifndef CNDF_ENABLED
+#define CNDF_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#if CNDF_ENABLED > 0
+
+// Degree of the polynomial
+#ifndef CNDF_PRECISION
+#define CNDF_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
+
+// cndf(-x) piecewise: piece i holds cndf(-(i + u) * CNDF_POLY_RANGE / CNDF_POLY_PIECES) for u in [0, 1], beyond that cndf is taken as 0 or 1
+__host int32_t cndf_coefficients[CNDF_POLY_PIECES][CNDF_PRECISION + 1];
+
+// Function
+static inline int cndfi_core(int x) {
+    int negative;
+    int x_abs = symmetry_fold_fixed(x, &negative);
+    int32_t y = 0;
+    if (x_abs < CNDF_POLY_RANGE * POLY_FIXED_ONE) {
+        int32_t u = CNDF_POLY_PIECES == CNDF_POLY_RANGE ? x_abs : POLY_MULT(x_abs, POLY_FIXED_CNDF_SCALE);
+        int piece = u >> FIXED_FRACTION_BITS;
+        piece = piece < CNDF_POLY_PIECES ? piece : CNDF_POLY_PIECES - 1; // Rounding of the scale
+        y = poly_fixed(cndf_coefficients[piece], CNDF_PRECISION, u - (piece << FIXED_FRACTION_BITS));
+    }
+    return symmetry_complement_fixed(y, negative);
+}
+
+int cndfi(int x) {
+    return cndfi_core(x);
+}
+
+#if VECTOR_FUNCTIONS > 0
+void cndfi_v(__mram_ptr const int *in, __mram_ptr int *out, uint32_t n) {
+    VECTOR_LOOP(int, in, out, n, x, cndfi_core(x));
+}
+#endif
+
+#endif
@@ -0,0 +1,140 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+#include <float.h>
+#include "_table_transfer.c"
+
+#ifndef COMPRESSED_TABLES_HOST
+#define COMPRESSED_TABLES_HOST
+
+/*
+ * Encoder for compressed tables with 16 bit entries (see dpu/_compressed_tables.c for the format)
+ *
+ * The tables are generated block by block: the values of a block give the line through its first and last value
+ * and the residuals to it. The fixed point format of the residuals is the most precise one in which the largest
+ * residual of the block still fits into 16 bits. Block headers and residuals are transferred as two tables
+ * (<symbol>_blocks and <symbol>), both are generated from the same values, so every value is computed twice.
+ */
+
+#ifndef COMPRESSED_TABLES
+#define COMPRESSED_TABLES 0 // This needs to match on CPU and DPU side!
+#endif
+
+#ifndef COMPRESSED_TABLE_BLOCK_BITS
+#define COMPRESSED_TABLE_BLOCK_BITS 6 // This needs to match on CPU and DPU side!
+#endif
+
+#define COMPRESSED_TABLE_BLOCK_SIZE (1 << COMPRESSED_TABLE_BLOCK_BITS)
+
+// Smaller residuals would make the DPU side produce floats that are not normal
+#define COMPRESSED_TABLE_MAX_FRACTION_BITS 100
+
+// This needs to match on CPU and DPU side!
+typedef struct {
+    float base; // First value of the block
+    float slope; // (last value - first value) / COMPRESSED_TABLE_BLOCK_SIZE
+    int32_t fraction_bits; // Fixed point format of the residuals
+    int32_t unused; // Keeps the blocks 8 byte aligned for MRAM
+} compressed_table_block;
+
+// Value of the entry at index, the method gives the function and its parameters
+typedef double (*table_value_function)(const void *parameters, int index);
+
+typedef struct {
+    table_value_function value;
+    const void *parameters;
+} compressed_table_parameters;
+
+// Computes the header and the COMPRESSED_TABLE_BLOCK_SIZE + 1 residuals of a block
+static void compressed_table_encode_block(const compressed_table_parameters *p, int block_index, compressed_table_block *block, int16_t *residuals) {
+    double values[COMPRESSED_TABLE_BLOCK_SIZE + 1];
+    double differences[COMPRESSED_TABLE_BLOCK_SIZE + 1];
+    double largest = 0;
+
+    for (int k = 0; k <= COMPRESSED_TABLE_BLOCK_SIZE; ++k) {
+        values[k] = p->value(p->parameters, (block_index << COMPRESSED_TABLE_BLOCK_BITS) + k);
+        // Infinite values (e.g. log(0)) are saturated, so that the line through the block stays finite
+        values[k] = values[k] > FLT_MAX ? FLT_MAX : values[k] < -FLT_MAX ? -FLT_MAX : values[k];
+    }
+
+    block->base = (float) values[0];
+    block->slope = (float) ((values[COMPRESSED_TABLE_BLOCK_SIZE] - values[0]) / COMPRESSED_TABLE_BLOCK_SIZE);
+    block->unused = 0;
+
+    // Residuals to the line as the DPU computes it in float
+    for (int k = 0; k <= COMPRESSED_TABLE_BLOCK_SIZE; ++k) {
+        float line = block->base + block->slope * (float) k;
+        differences[k] = values[k] - line;
+        largest = fabs(differences[k]) > largest ? fabs(differences[k]) : largest;
+    }
+
+    int exponent;
+    frexp(largest, &exponent); // largest < 2^exponent
+    block->fraction_bits = largest > 0 ? 15 - exponent : 0;
+    if (block->fraction_bits > COMPRESSED_TABLE_MAX_FRACTION_BITS) {
+        block->fraction_bits = COMPRESSED_TABLE_MAX_FRACTION_BITS;
+    }
+
+    for (int k = 0; k <= COMPRESSED_TABLE_BLOCK_SIZE; ++k) {
+        double residual = floor(ldexp(differences[k], block->fraction_bits) + 0.5);
+        residuals[k] = (int16_t) (residual > INT16_MAX ? INT16_MAX : residual < INT16_MIN ? INT16_MIN : residual);
+    }
+}
+
+// Fills block headers first to first + count - 1 (see _table_transfer.c)
+static void compressed_table_fill_blocks(const void *parameters, void *chunk, int first, int count) {
+    compressed_table_block *blocks = chunk;
+    int16_t residuals[COMPRESSED_TABLE_BLOCK_SIZE + 1];
+
+    for (int i = 0; i < count; ++i) {
+        compressed_table_encode_block(parameters, first + i, &blocks[i], residuals);
+    }
+}
+
+// Fills residuals first to first + count - 1, a block is only encoded once even if several of its residuals are needed
+static void compressed_table_fill_residuals(const void *parameters, void *chunk, int first, int count) {
+    int16_t *table = chunk;
+    compressed_table_block block;
+    int16_t residuals[COMPRESSED_TABLE_BLOCK_SIZE + 1];
+    int encoded = -1;
+
+    for (int i = 0; i < count; ++i) {
+        int block_index = (first + i) / (COMPRESSED_TABLE_BLOCK_SIZE + 1);
+        if (block_index != encoded) {
+            compressed_table_encode_block(parameters, block_index, &block, residuals);
+            encoded = block_index;
+        }
+        table[i] = residuals[(first + i) % (COMPRESSED_TABLE_BLOCK_SIZE + 1)];
+    }
+}
+
+/*
+ * Generates a compressed table with the given number of entries and broadcasts it to the DPUs
+ * Inputs
+ * symbol: name of the table on the DPU side, the block headers are in <symbol>_blocks
+ * key: identifies the table in the on-disk cache, the format is set here
+ * value() & parameters: value of an entry
+ */
+void broadcast_compressed_table(struct dpu_set_t set, const char *symbol, int table_id, const table_disk_cache_key *key, int entries,
+                                table_value_function value, const void *parameters) {
+    compressed_table_parameters compressed = {value, parameters};
+    int blocks = entries >> COMPRESSED_TABLE_BLOCK_BITS;
+    char blocks_symbol[64];
+    char format[32];
+
+    snprintf(blocks_symbol, sizeof(blocks_symbol), "%s_blocks", symbol);
+    snprintf(format, sizeof(format), "compressed16-%d", COMPRESSED_TABLE_BLOCK_BITS);
+    table_disk_cache_key residuals_key = *key;
+    residuals_key.format = format;
+
+    char blocks_format[40];
+    snprintf(blocks_format, sizeof(blocks_format), "compressed16-%d-blocks", COMPRESSED_TABLE_BLOCK_BITS);
+    table_disk_cache_key blocks_key = *key;
+    blocks_key.format = blocks_format;
+
+    // Padded to 8 bytes, like TABLE_WORDS() on the DPU side
+    broadcast_table(set, symbol, table_id, &residuals_key, sizeof(int16_t), entries + blocks + 4, compressed_table_fill_residuals, &compressed);
+    broadcast_table(set, blocks_symbol, table_id, &blocks_key, sizeof(compressed_table_block), blocks, compressed_table_fill_blocks, &compressed);
+}
+
+#endif
@@ -0,0 +1,182 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#ifndef RESIDENT_HOST
+#define RESIDENT_HOST
+
+/*
+ * Host side of the resident DPU program (see dpu/_resident.c), include after the host file of the method
+ *
+ * resident_start() loads the program and broadcasts the tables once. After that, resident_submit() can be called
+ * any number of times: it sends a list of batches with as few launches as possible, without reloading anything.
+ * Each batch is split evenly across all DPUs of the set.
+ */
+
+#ifndef RESIDENT_MAX_COMMANDS
+#define RESIDENT_MAX_COMMANDS 64 // This needs to match on CPU and DPU side!
+#endif
+
+#ifndef RESIDENT_BUFFER_BYTES
+#define RESIDENT_BUFFER_BYTES (16 << 20) // This needs to match on CPU and DPU side!
+#endif
+
+// Function ids, this needs to match on CPU and DPU side!
+#define RESIDENT_SINF 0
+#define RESIDENT_COSF 1
+#define RESIDENT_TANF 2
+#define RESIDENT_SINHF 3
+#define RESIDENT_COSHF 4
+#define RESIDENT_TANHF 5
+#define RESIDENT_EXPF 6
+#define RESIDENT_LOGF 7
+#define RESIDENT_SQRTF 8
+#define RESIDENT_CNDF 9
+#define RESIDENT_GELU 10
+#define RESIDENT_FUNCTIONS 11
+
+// This needs to match on CPU and DPU side!
+typedef struct {
+    uint32_t function;
+    uint32_t input_offset;
+    uint32_t output_offset;
+    uint32_t count;
+} resident_command;
+
+typedef struct {
+    uint32_t function; // RESIDENT_EXPF, ...
+    const float *input;
+    float *output; // Can be the same as input
+    uint32_t count;
+} resident_batch;
+
+void resident_start(struct dpu_set_t set, const char *binary) {
+    DPU_ASSERT(dpu_load(set, binary, NULL));
+    broadcast_tables(set);
+}
+
+// One part of a batch that is sent with a launch
+typedef struct {
+    const float *input;
+    float *output;
+    uint32_t count;
+    uint32_t per_dpu;
+    float *padding; // For the DPUs that get less than per_dpu elements
+} resident_part;
+
+// Transfers the parts of all DPUs, full parts directly from / to the batch, the rest through the padding
+static void resident_transfer(struct dpu_set_t set, uint32_t nr_dpus, resident_part *part, uint32_t offset, int to_dpu) {
+    struct dpu_set_t dpu;
+    uint32_t full = part->count / part->per_dpu;
+    uint32_t i;
+
+    if (to_dpu) {
+        memset(part->padding, 0, sizeof(float) * part->per_dpu * (nr_dpus - full));
+        memcpy(part->padding, part->input + full * part->per_dpu, sizeof(float) * (part->count - full * part->per_dpu));
+    }
+
+    DPU_FOREACH(set, dpu, i) {
+        float *buffer = i < full ? (to_dpu ? (float *) part->input : part->output) + i * part->per_dpu : part->padding + (i - full) * part->per_dpu;
+        DPU_ASSERT(dpu_prepare_xfer(dpu, buffer));
+    }
+    DPU_ASSERT(dpu_push_xfer(set, to_dpu ? DPU_XFER_TO_DPU : DPU_XFER_FROM_DPU, "resident_buffer", offset, sizeof(float) * part->per_dpu, DPU_XFER_DEFAULT));
+
+    if (!to_dpu) {
+        memcpy(part->output + full * part->per_dpu, part->padding, sizeof(float) * (part->count - full * part->per_dpu));
+    }
+}
+
+// Computes all batches on the DPUs, returns when the outputs are written
+void resident_submit(struct dpu_set_t set, const resident_batch batches[], int nr_batches) {
+    uint32_t nr_dpus;
+    DPU_ASSERT(dpu_get_nr_dpus(set, &nr_dpus));
+
+    resident_command commands[RESIDENT_MAX_COMMANDS];
+    resident_part parts[RESIDENT_MAX_COMMANDS];
+    int batch = 0;
+    uint32_t done = 0; // Elements of the current batch that are already sent
+
+    while (batch < nr_batches) {
+        // Fill the command list of one launch until it or the MRAM buffer is full
+        uint32_t nr_commands = 0;
+        uint32_t used_bytes = 0;
+        size_t padding_floats = 0;
+
+        while (batch < nr_batches && nr_commands < RESIDENT_MAX_COMMANDS) {
+            uint32_t available = ((RESIDENT_BUFFER_BYTES - used_bytes) / sizeof(float)) & ~1;
+            if (available == 0) {
+                break;
+            }
+
+            uint32_t remaining = batches[batch].count - done;
+            uint32_t count = remaining < (uint64_t) nr_dpus * available ? remaining : nr_dpus * available;
+            uint32_t per_dpu = (count + nr_dpus - 1) / nr_dpus;
+            per_dpu += per_dpu % 2; // Round up so transfers are aligned to 8 bytes
+
+            if (count > 0) {
+                commands[nr_commands] = (resident_command) {batches[batch].function, used_bytes, used_bytes, per_dpu};
+                parts[nr_commands] = (resident_part) {batches[batch].input + done, batches[batch].output + done, count, per_dpu, NULL};
+                padding_floats += (size_t) per_dpu * (nr_dpus - count / per_dpu);
+                used_bytes += sizeof(float) * per_dpu;
+                nr_commands++;
+            }
+
+            done += count;
+            if (done == batches[batch].count) {
+                batch++;
+                done = 0;
+            }
+        }
+        if (nr_commands == 0) {
+            break;
+        }
+
+        float *padding = malloc(sizeof(float) * padding_floats);
+        if (padding == NULL && padding_floats > 0) {
+            fprintf(stderr, "Could not allocate %zu bytes for the resident batches\n", sizeof(float) * padding_floats);
+            exit(EXIT_FAILURE);
+        }
+        for (uint32_t c = 0, padding_offset = 0; c < nr_commands; c++) {
+            parts[c].padding = padding + padding_offset;
+            padding_offset += parts[c].per_dpu * (nr_dpus - parts[c].count / parts[c].per_dpu);
+            resident_transfer(set, nr_dpus, &parts[c], commands[c].input_offset, 1);
+        }
+
+        DPU_ASSERT(dpu_broadcast_to(set, "resident_commands", 0, commands, sizeof(resident_command) * nr_commands, DPU_XFER_DEFAULT));
+        DPU_ASSERT(dpu_broadcast_to(set, "resident_nr_commands", 0, &nr_commands, sizeof(uint32_t), DPU_XFER_DEFAULT));
+        DPU_ASSERT(dpu_launch(set, DPU_SYNCHRONOUS));
+
+        // All DPUs run the same commands, so the first one tells whether a function was missing
+        struct dpu_set_t dpu;
+        uint32_t error = 0;
+        DPU_FOREACH(set, dpu) {
+            DPU_ASSERT(dpu_copy_from(dpu, "resident_error", 0, &error, sizeof(uint32_t)));
+            break;
+        }
+        if (error != 0) {
+            fprintf(stderr, "Function %u is not compiled into the resident DPU program\n", commands[error - 1].function);
+            exit(EXIT_FAILURE);
+        }
+
+        for (uint32_t c = 0; c < nr_commands; c++) {
+            resident_transfer(set, nr_dpus, &parts[c], commands[c].output_offset, 0);
+        }
+        free(padding);
+    }
+}
+
+/*
+ * Basic Usage:
+ *
+ * #include "lut_ldexpf_host.c"
+ * #include "_resident_host.c"
+ *
+ * resident_start(set, "bin/resident");
+ * for (...) {
+ *     resident_batch batches[] = {{RESIDENT_EXPF, input, output, size}, {RESIDENT_LOGF, input2, output2, size2}};
+ *     resident_submit(set, batches, 2);
+ * }
+ */
+
+#endif
@@ -0,0 +1,54 @@
+#include <stdio.h>
+#include <stdint.h>
+
+#ifndef TABLE_CACHE_HOST
+#define TABLE_CACHE_HOST
+
+/*
+ * Host side helpers for the WRAM table cache (dpu/_table_cache.c)
+ * Only usable if the DPU program was compiled with -D TABLE_CACHE=1
+ */
+
+#ifndef TABLE_CACHE_TILES
+#define TABLE_CACHE_TILES 32 // This needs to match on CPU and DPU side!
+#endif
+
+#define TABLE_CACHE_MAX_TABLES 8 // This needs to match on CPU and DPU side!
+#define TABLE_CACHE_MAX_TASKLETS 24 // This needs to match on CPU and DPU side!
+
+// Empties the cache, this is needed when the tables are changed between two launches of the same program
+void table_cache_reset(struct dpu_set_t set) {
+    uint32_t tags[TABLE_CACHE_TILES] = {0};
+    DPU_ASSERT(dpu_broadcast_to(set, "table_cache_tags", 0, tags, sizeof(tags), DPU_XFER_DEFAULT));
+}
+
+// Sums up the hits and misses of all DPUs and tasklets and prints them per table (ids as defined with <NAME>_TABLE_ID)
+void table_cache_print_stats(struct dpu_set_t set) {
+    uint32_t hits[TABLE_CACHE_MAX_TASKLETS][TABLE_CACHE_MAX_TABLES];
+    uint32_t misses[TABLE_CACHE_MAX_TASKLETS][TABLE_CACHE_MAX_TABLES];
+    uint64_t total_hits[TABLE_CACHE_MAX_TABLES] = {0};
+    uint64_t total_misses[TABLE_CACHE_MAX_TABLES] = {0};
+    struct dpu_set_t dpu;
+
+    DPU_FOREACH(set, dpu) {
+        DPU_ASSERT(dpu_copy_from(dpu, "table_cache_hits", 0, hits, sizeof(hits)));
+        DPU_ASSERT(dpu_copy_from(dpu, "table_cache_misses", 0, misses, sizeof(misses)));
+
+        for (int tasklet = 0; tasklet < TABLE_CACHE_MAX_TASKLETS; tasklet++) {
+            for (int table = 0; table < TABLE_CACHE_MAX_TABLES; table++) {
+                total_hits[table] += hits[tasklet][table];
+                total_misses[table] += misses[tasklet][table];
+            }
+        }
+    }
+
+    for (int table = 0; table < TABLE_CACHE_MAX_TABLES; table++) {
+        uint64_t total = total_hits[table] + total_misses[table];
+        if (total > 0) {
+            printf("Table Cache (Table %d):                    %lu hits, %lu misses (%.2f%% hit rate)\n",
+                   table, (unsigned long) total_hits[table], (unsigned long) total_misses[table], 100.0 * (double) total_hits[table] / (double) total);
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,173 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#ifndef TABLE_DISK_CACHE_HOST
+#define TABLE_DISK_CACHE_HOST
+
+/*
+ * On-disk cache for generated lookup tables
+ *
+ * With -D TABLE_DISK_CACHE=1, broadcast_table() (_table_transfer.c) first looks for a table generated by an earlier run,
+ * and transfers it straight from the memory mapped file. Otherwise the table is generated and saved while it is transferred.
+ * A table is identified by method, function, number of entries, input range and number format.
+ * The files are placed in TABLE_DISK_CACHE_DIR, or in the directory given by the environment variable TRANSPIMLIB_TABLE_CACHE.
+ *
+ * Increase TABLE_DISK_CACHE_VERSION whenever the way a table is generated changes, so old files are not used anymore.
+ */
+
+#ifndef TABLE_DISK_CACHE
+#define TABLE_DISK_CACHE 0
+#endif
+
+#ifndef TABLE_DISK_CACHE_DIR
+#define TABLE_DISK_CACHE_DIR ".table_cache"
+#endif
+
+#define TABLE_DISK_CACHE_MAGIC 0x544c5054 // "TPLT"
+#define TABLE_DISK_CACHE_VERSION 2
+#define TABLE_DISK_CACHE_KEY_SIZE 192
+#define TABLE_DISK_CACHE_PATH_SIZE 512
+
+typedef struct {
+    const char *method;
+    const char *function;
+    int entries;
+    double lower;
+    double upper;
+    const char *format; // e.g. "float32" or "fixed24", anything else the table depends on can be added here as well
+} table_disk_cache_key;
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    char key[TABLE_DISK_CACHE_KEY_SIZE];
+    uint64_t table_bytes;
+} table_disk_cache_header;
+
+#if TABLE_DISK_CACHE > 0
+// Returns the directory of the cache files
+static const char *table_disk_cache_dir() {
+    const char *dir = getenv("TRANSPIMLIB_TABLE_CACHE");
+    return (dir != NULL && dir[0] != '\0') ? dir : TABLE_DISK_CACHE_DIR;
+}
+
+// Writes the full key into key_string and the file name (readable prefix + hash of the full key) into path
+static void table_disk_cache_name(const table_disk_cache_key *key, char key_string[], char path[]) {
+    snprintf(key_string, TABLE_DISK_CACHE_KEY_SIZE, "%s/%s/%d/%a/%a/%s",
+             key->method, key->function, key->entries, key->lower, key->upper, key->format);
+
+    // FNV-1a
+    uint64_t hash = 14695981039346656037ULL;
+    for (const char *c = key_string; *c != '\0'; c++) {
+        hash = (hash ^ (uint8_t) *c) * 1099511628211ULL;
+    }
+
+    snprintf(path, TABLE_DISK_CACHE_PATH_SIZE, "%s/%s_%s_%d_%016llx.tbl",
+             table_disk_cache_dir(), key->method, key->function, key->entries, (unsigned long long) hash);
+}
+#endif
+
+typedef struct {
+    void *data; // The whole file, the table starts after the header
+    size_t bytes;
+} table_disk_cache_mapping;
+
+typedef struct {
+    FILE *file;
+    char path[TABLE_DISK_CACHE_PATH_SIZE];
+    char temporary_path[TABLE_DISK_CACHE_PATH_SIZE + 32];
+    int ok;
+} table_disk_cache_writer;
+
+// Maps a cached table into memory, returns the table (or NULL if there is no valid cache file)
+const void *table_disk_cache_map(const table_disk_cache_key *key, size_t table_bytes, table_disk_cache_mapping *mapping) {
+#if TABLE_DISK_CACHE > 0
+    char key_string[TABLE_DISK_CACHE_KEY_SIZE];
+    char path[TABLE_DISK_CACHE_PATH_SIZE];
+    table_disk_cache_name(key, key_string, path);
+
+    int file = open(path, O_RDONLY);
+    if (file < 0) {
+        return NULL;
+    }
+
+    size_t file_bytes = sizeof(table_disk_cache_header) + table_bytes;
+    struct stat file_stat;
+    if (fstat(file, &file_stat) != 0 || (size_t) file_stat.st_size != file_bytes) {
+        close(file);
+        return NULL;
+    }
+
+    uint8_t *data = mmap(NULL, file_bytes, PROT_READ, MAP_PRIVATE, file, 0);
+    close(file);
+    if (data == MAP_FAILED) {
+        return NULL;
+    }
+
+    const table_disk_cache_header *header = (const table_disk_cache_header *) data;
+    if (header->magic != TABLE_DISK_CACHE_MAGIC || header->version != TABLE_DISK_CACHE_VERSION ||
+        header->table_bytes != table_bytes || strncmp(header->key, key_string, TABLE_DISK_CACHE_KEY_SIZE) != 0) {
+        munmap(data, file_bytes);
+        return NULL;
+    }
+
+    mapping->data = data;
+    mapping->bytes = file_bytes;
+    return data + sizeof(table_disk_cache_header);
+#else
+    return NULL;
+#endif
+}
+
+void table_disk_cache_unmap(table_disk_cache_mapping *mapping) {
+#if TABLE_DISK_CACHE > 0
+    munmap(mapping->data, mapping->bytes);
+#endif
+}
+
+/*
+ * Saves a table while it is generated: table_disk_cache_begin(), table_disk_cache_write() for every part in order, table_disk_cache_commit()
+ * Errors are ignored (the table is just generated again next time)
+ */
+void table_disk_cache_begin(const table_disk_cache_key *key, size_t table_bytes, table_disk_cache_writer *writer) {
+    writer->file = NULL;
+    writer->ok = 0;
+#if TABLE_DISK_CACHE > 0
+    table_disk_cache_header header = {0};
+
+    header.magic = TABLE_DISK_CACHE_MAGIC;
+    header.version = TABLE_DISK_CACHE_VERSION;
+    header.table_bytes = table_bytes;
+    table_disk_cache_name(key, header.key, writer->path);
+
+    mkdir(table_disk_cache_dir(), 0755);
+
+    // Write to a temporary file first, so that concurrent runs never see a partially written table
+    snprintf(writer->temporary_path, sizeof(writer->temporary_path), "%s.%d.tmp", writer->path, (int) getpid());
+    writer->file = fopen(writer->temporary_path, "wb");
+    writer->ok = writer->file != NULL && fwrite(&header, sizeof(header), 1, writer->file) == 1;
+#endif
+}
+
+void table_disk_cache_write(table_disk_cache_writer *writer, const void *part, size_t bytes) {
+    if (writer->ok) {
+        writer->ok = fwrite(part, 1, bytes, writer->file) == bytes;
+    }
+}
+
+void table_disk_cache_commit(table_disk_cache_writer *writer) {
+    if (writer->file == NULL) {
+        return;
+    }
+    if (fclose(writer->file) != 0 || !writer->ok || rename(writer->temporary_path, writer->path) != 0) {
+        remove(writer->temporary_path);
+    }
+}
+
+#endif
@@ -0,0 +1,33 @@
+#include <stdio.h>
+#include <stdint.h>
+
+#ifndef TABLE_STAGING_HOST
+#define TABLE_STAGING_HOST
+
+/*
+ * Host side helpers for staged tables (dpu/_table_staging.c)
+ * Only usable if the DPU program has at least one table with <NAME>_STORE_IN_WRAM=2 and calls table_staging()
+ */
+
+// Prints the cycles it took to copy the staged tables into WRAM (average and maximum over all DPUs)
+void table_staging_print_stats(struct dpu_set_t set) {
+    uint32_t cycles;
+    uint64_t total_cycles = 0;
+    uint32_t max_cycles = 0;
+    uint32_t nr_dpus = 0;
+    struct dpu_set_t dpu;
+
+    DPU_FOREACH(set, dpu) {
+        DPU_ASSERT(dpu_copy_from(dpu, "table_staging_cycles", 0, &cycles, sizeof(uint32_t)));
+        total_cycles += cycles;
+        max_cycles = cycles > max_cycles ? cycles : max_cycles;
+        nr_dpus++;
+    }
+
+    if (nr_dpus > 0) {
+        printf("Table Staging:                            %.0f cycles (average), %u cycles (max)\n",
+               (double) total_cycles / (double) nr_dpus, max_cycles);
+    }
+}
+
+#endif
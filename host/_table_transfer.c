@@ -0,0 +1,323 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <ctype.h>
+#include "_table_disk_cache.c"
+
+#ifndef TABLE_TRANSFER_HOST
+#define TABLE_TRANSFER_HOST
+
+/*
+ * Generation and transfer of tables in chunks
+ *
+ * Tables are never held completely in host memory: broadcast_table() generates TABLE_TRANSFER_CHUNK_BYTES at a time
+ * into heap buffers (shared by all tables) and broadcasts every chunk to its offset in the DPU symbol.
+ * That way, tables up to the size of the MRAM can be generated, independent of the stack size.
+ *
+ * Every chunk is split into equal index ranges that are generated by TABLE_GENERATION_THREADS threads.
+ * Each thread gets at least TABLE_GENERATION_MIN_ENTRIES entries, smaller chunks (and small tables) are generated by fewer
+ * threads, or by the calling thread alone, since starting a thread costs more than generating a few thousand entries.
+ * While the threads generate the next chunk, the main thread broadcasts the last one (double buffering).
+ * Each entry only depends on its index, so the tables are identical to the ones generated by a single thread.
+ *
+ * With -D PACKED_TABLES=1 (see dpu/_packed_tables.c), the tables are not transferred to their own symbols, but appended to
+ * one blob at the start of the MRAM heap, and their parameters are collected in a header. Chunks are only transferred
+ * once they are full, so many small tables end up in a single broadcast. table_transfer_finish() sends the rest and the header.
+ *
+ * While table_constants_file is set (see table_constants.c), nothing is generated or transferred: the setup of a method
+ * only writes its table parameters as compile time constants into that file (see dpu/_table_constants.c).
+ */
+
+#ifndef TABLE_TRANSFER_CHUNK_BYTES
+#define TABLE_TRANSFER_CHUNK_BYTES (1 << 20) // Needs to be a multiple of 8 (MRAM transfers)
+#endif
+
+#ifndef TABLE_GENERATION_THREADS
+#define TABLE_GENERATION_THREADS 0 // 0: one thread per online core
+#endif
+
+#ifndef TABLE_GENERATION_MIN_ENTRIES
+#define TABLE_GENERATION_MIN_ENTRIES 4096 // Per thread, a single part is generated without a thread
+#endif
+
+#ifndef PACKED_TABLES
+#define PACKED_TABLES 0 // This needs to match on CPU and DPU side!
+#endif
+
+#define PACKED_TABLES_MAX_TABLES 8 // This needs to match on CPU and DPU side!
+
+// This needs to match on CPU and DPU side!
+typedef struct {
+    uint32_t offset; // Position of the table in the blob (in bytes)
+    union {
+        int32_t i;
+        float f;
+    } parameter; // Spacing of the table (e.g. granularity exponent), if the method needs one
+} packed_table_entry;
+
+// Parameters of the LUT methods are ints (granularity exponents), lut_multi_host.c sets this for its float spacings
+#ifndef TABLE_PARAMETERS_ARE_FLOATS
+#define TABLE_PARAMETERS_ARE_FLOATS 0
+#endif
+
+static FILE *table_constants_file = NULL;
+
+// Writes the entries first to first + count - 1 of a table into chunk, parameters are given by the method
+typedef void (*table_fill_function)(const void *parameters, void *chunk, int first, int count);
+
+static void *table_transfer_buffer[2] = {NULL, NULL}; // Two chunks, one is generated while the other one is transferred
+static size_t table_transfer_buffer_bytes = 0;
+
+// Returns one of the shared chunk buffers with at least the given size
+static void *table_transfer_get_buffer(int index, size_t bytes) {
+    if (bytes > table_transfer_buffer_bytes) {
+        free(table_transfer_buffer[0]);
+        free(table_transfer_buffer[1]);
+        table_transfer_buffer[0] = malloc(bytes);
+        table_transfer_buffer[1] = malloc(bytes);
+        if (table_transfer_buffer[0] == NULL || table_transfer_buffer[1] == NULL) {
+            fprintf(stderr, "Could not allocate 2 x %zu bytes for table generation\n", bytes);
+            exit(EXIT_FAILURE);
+        }
+        table_transfer_buffer_bytes = bytes;
+    }
+    return table_transfer_buffer[index];
+}
+
+static int table_generation_threads() {
+    int threads = TABLE_GENERATION_THREADS;
+    if (threads <= 0) {
+        threads = (int) sysconf(_SC_NPROCESSORS_ONLN);
+    }
+    return threads < 1 ? 1 : threads;
+}
+
+#if PACKED_TABLES > 0
+static packed_table_entry packed_tables_header[PACKED_TABLES_MAX_TABLES];
+static char *packed_tables_buffer = NULL; // The part of the blob that is not transferred yet
+static size_t packed_tables_buffered = 0;
+static size_t packed_tables_transferred = 0;
+
+static void packed_tables_flush(struct dpu_set_t set) {
+    if (packed_tables_buffered > 0) {
+        DPU_ASSERT(dpu_broadcast_to(set, DPU_MRAM_HEAP_POINTER_NAME, packed_tables_transferred, packed_tables_buffer, packed_tables_buffered, DPU_XFER_DEFAULT));
+        packed_tables_transferred += packed_tables_buffered;
+        packed_tables_buffered = 0;
+    }
+}
+
+static void packed_tables_append(struct dpu_set_t set, const void *data, size_t bytes) {
+    if (packed_tables_buffer == NULL) {
+        packed_tables_buffer = malloc(TABLE_TRANSFER_CHUNK_BYTES);
+        if (packed_tables_buffer == NULL) {
+            fprintf(stderr, "Could not allocate %d bytes for table generation\n", TABLE_TRANSFER_CHUNK_BYTES);
+            exit(EXIT_FAILURE);
+        }
+    }
+    while (bytes > 0) {
+        size_t part = TABLE_TRANSFER_CHUNK_BYTES - packed_tables_buffered;
+        part = bytes < part ? bytes : part;
+
+        memcpy(packed_tables_buffer + packed_tables_buffered, data, part);
+        packed_tables_buffered += part;
+        data = (const char *) data + part;
+        bytes -= part;
+
+        if (packed_tables_buffered == TABLE_TRANSFER_CHUNK_BYTES) {
+            packed_tables_flush(set);
+        }
+    }
+}
+
+// Starts a new table in the blob (8 byte aligned for MRAM transfers)
+static void packed_tables_start(struct dpu_set_t set, int table_id) {
+    static const char padding[8] = {0};
+    size_t size = packed_tables_transferred + packed_tables_buffered;
+
+    packed_tables_append(set, padding, (8 - (size & 7)) & 7);
+    packed_tables_header[table_id].offset = (uint32_t) (packed_tables_transferred + packed_tables_buffered);
+}
+#endif
+
+// Transfers a part of a table (at offset bytes from its start), parts need to be written in order
+static void table_transfer_write(struct dpu_set_t set, const char *symbol, size_t offset, const void *data, size_t bytes) {
+#if PACKED_TABLES > 0
+    packed_tables_append(set, data, bytes);
+#else
+    DPU_ASSERT(dpu_broadcast_to(set, symbol, offset, data, bytes, DPU_XFER_DEFAULT));
+#endif
+}
+
+/*
+ * Transfers a parameter of a table (4 bytes, e.g. the granularity exponent)
+ * With packed tables it is sent with the header, otherwise it is broadcast to its symbol right away
+ */
+void broadcast_table_parameter(struct dpu_set_t set, const char *symbol, int table_id, const void *value) {
+    if (table_constants_file != NULL) {
+        fprintf(table_constants_file, "#define ");
+        for (const char *c = symbol; *c != '\0'; c++) {
+            fputc(toupper((unsigned char) *c), table_constants_file);
+        }
+#if TABLE_PARAMETERS_ARE_FLOATS > 0
+        fprintf(table_constants_file, "_CONSTANT %af\n", *(const float *) value); // Hexadecimal, so that the float is exact
+#else
+        fprintf(table_constants_file, "_CONSTANT (%d)\n", *(const int32_t *) value);
+#endif
+        return;
+    }
+
+#if PACKED_TABLES > 0
+    memcpy(&packed_tables_header[table_id].parameter, value, sizeof(packed_tables_header[table_id].parameter));
+#else
+    DPU_ASSERT(dpu_broadcast_to(set, symbol, 0, value, sizeof(int32_t), DPU_XFER_DEFAULT));
+#endif
+}
+
+// Transfers whatever is still outstanding and releases all buffers, call after all tables are transferred
+void table_transfer_finish(struct dpu_set_t set) {
+#if PACKED_TABLES > 0
+    if (table_constants_file != NULL) {
+        return;
+    }
+
+    static const char padding[8] = {0};
+    packed_tables_append(set, padding, (8 - (packed_tables_buffered & 7)) & 7);
+    packed_tables_flush(set);
+    DPU_ASSERT(dpu_broadcast_to(set, "packed_tables_header", 0, packed_tables_header, sizeof(packed_tables_header), DPU_XFER_DEFAULT));
+
+    free(packed_tables_buffer);
+    packed_tables_buffer = NULL;
+    packed_tables_transferred = 0;
+#endif
+    free(table_transfer_buffer[0]);
+    free(table_transfer_buffer[1]);
+    table_transfer_buffer[0] = NULL;
+    table_transfer_buffer[1] = NULL;
+    table_transfer_buffer_bytes = 0;
+}
+
+// One index range of a chunk, generated by its own thread
+typedef struct {
+    pthread_t thread;
+    int started;
+    table_fill_function fill;
+    const void *parameters;
+    char *chunk;
+    int first;
+    int count;
+} table_generation_part;
+
+static void *table_generation_run(void *argument) {
+    table_generation_part *part = argument;
+    part->fill(part->parameters, part->chunk, part->first, part->count);
+    return NULL;
+}
+
+// Starts generating the entries first to first + count - 1 into chunk, returns immediately
+static void table_generation_start(table_generation_part parts[], int threads, table_fill_function fill, const void *parameters,
+                                   size_t entry_bytes, void *chunk, int first, int count) {
+    int used_threads = (count + TABLE_GENERATION_MIN_ENTRIES - 1) / TABLE_GENERATION_MIN_ENTRIES;
+    used_threads = used_threads < threads ? used_threads : threads;
+    used_threads = used_threads < 1 ? 1 : used_threads;
+    int part_entries = (count + used_threads - 1) / used_threads;
+
+    for (int t = 0; t < threads; t++) {
+        table_generation_part *part = &parts[t];
+        int part_first = t * part_entries;
+
+        part->started = 0;
+        if (part_first >= count) {
+            continue;
+        }
+        part->fill = fill;
+        part->parameters = parameters;
+        part->chunk = (char *) chunk + entry_bytes * part_first;
+        part->first = first + part_first;
+        part->count = count - part_first < part_entries ? count - part_first : part_entries;
+
+        part->started = used_threads > 1 && pthread_create(&part->thread, NULL, table_generation_run, part) == 0;
+        if (!part->started) {
+            table_generation_run(part); // Only one part or no thread available, generate this part right here
+        }
+    }
+}
+
+// Waits until the chunk is complete
+static void table_generation_wait(table_generation_part parts[], int threads) {
+    for (int t = 0; t < threads; t++) {
+        if (parts[t].started) {
+            pthread_join(parts[t].thread, NULL);
+        }
+    }
+}
+
+/*
+ * Generates a table chunk by chunk and broadcasts it to the DPUs
+ * Inputs
+ * symbol: name of the table on the DPU side
+ * table_id: position of the table in the header of packed tables
+ * key: identifies the table in the on-disk cache (see _table_disk_cache.c)
+ * entry_bytes & entries: size of the table
+ * fill() & parameters: generate a range of entries
+ */
+void broadcast_table(struct dpu_set_t set, const char *symbol, int table_id, const table_disk_cache_key *key, size_t entry_bytes, int entries,
+                     table_fill_function fill, const void *parameters) {
+    size_t table_bytes = entry_bytes * entries;
+
+    if (table_constants_file != NULL) {
+        return;
+    }
+
+#if PACKED_TABLES > 0
+    packed_tables_start(set, table_id);
+#endif
+
+    // Generated in an earlier run, transfer it straight from the file
+    table_disk_cache_mapping mapping;
+    const char *cached = table_disk_cache_map(key, table_bytes, &mapping);
+    if (cached != NULL) {
+        for (size_t offset = 0; offset < table_bytes; offset += TABLE_TRANSFER_CHUNK_BYTES) {
+            size_t bytes = table_bytes - offset < TABLE_TRANSFER_CHUNK_BYTES ? table_bytes - offset : TABLE_TRANSFER_CHUNK_BYTES;
+            table_transfer_write(set, symbol, offset, cached + offset, bytes);
+        }
+        table_disk_cache_unmap(&mapping);
+        return;
+    }
+
+    int chunk_entries = TABLE_TRANSFER_CHUNK_BYTES / entry_bytes;
+    if (chunk_entries > entries) {
+        chunk_entries = entries;
+    }
+    void *chunk[2] = {table_transfer_get_buffer(0, entry_bytes * chunk_entries), table_transfer_get_buffer(1, entry_bytes * chunk_entries)};
+
+    table_disk_cache_writer writer;
+    table_disk_cache_begin(key, table_bytes, &writer);
+
+    int threads = table_generation_threads();
+    table_generation_part parts[threads];
+
+    int count = entries < chunk_entries ? entries : chunk_entries;
+    table_generation_start(parts, threads, fill, parameters, entry_bytes, chunk[0], 0, count);
+
+    for (int first = 0, current = 0; first < entries; first += chunk_entries, current ^= 1) {
+        int next = first + chunk_entries;
+        table_generation_wait(parts, threads);
+
+        // Generate the next chunk while this one is transferred
+        if (next < entries) {
+            int next_count = entries - next < chunk_entries ? entries - next : chunk_entries;
+            table_generation_start(parts, threads, fill, parameters, entry_bytes, chunk[current ^ 1], next, next_count);
+        }
+
+        count = entries - first < chunk_entries ? entries - first : chunk_entries;
+        table_disk_cache_write(&writer, chunk[current], entry_bytes * count);
+        table_transfer_write(set, symbol, entry_bytes * first, chunk[current], entry_bytes * count);
+    }
+
+    table_disk_cache_commit(&writer);
+}
+
+#endif
@@ -0,0 +1,204 @@
+#include <math.h>
+#include "_table_transfer.c"
+#ifdef MEASURE
+    #include <time.h>
+#endif
+
+/*
+ * Host side of the bipartite LUT (lut_bipartite.c)
+ *
+ * A table with p address bits has a spacing h (a power of 2) and starts at lower, address a stands for
+ * the input lower + (a + 0.5) * h. With a = x0 x1 x2 (see BIPARTITE_OUTER_BITS), the two tables hold
+ * initial_values[x0 x1] = f at the centre of the block x0 x1 (x2 in the middle)
+ * offsets[x0 x2] = f(x0 x1 x2) - f(x0 x1 centre) for x1 in the middle of its range
+ */
+
+// Precision overall - could be externally defined
+#ifndef PRECISION
+#define PRECISION 14 // This needs to match on CPU and DPU side!
+#endif
+
+// Precision per function - could be externally defined, otherwise derived from PRECISION
+#ifndef SIN_COS_TAN_PRECISION
+#define SIN_COS_TAN_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
+#ifndef EXP_PRECISION
+#define EXP_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
+#ifndef LOG_PRECISION
+#define LOG_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
+#ifndef SQRT_PRECISION
+#define SQRT_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
+
+// Functions whose tables are generated and transferred - could be externally defined
+#ifndef ALL_FUNCTIONS_ENABLED
+#define ALL_FUNCTIONS_ENABLED 1 // This needs to match on CPU and DPU side!
+#endif
+#ifndef SIN_COS_TAN_ENABLED
+#define SIN_COS_TAN_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+#ifndef EXP_ENABLED
+#define EXP_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+#ifndef LOG_ENABLED
+#define LOG_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+#ifndef SQRT_ENABLED
+#define SQRT_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+// Split of an address with p bits, this needs to match on CPU and DPU side!
+#define BIPARTITE_OUTER_BITS(p) ((p) / 3)
+#define BIPARTITE_INITIAL_VALUES(p) (1 << ((p) - BIPARTITE_OUTER_BITS(p)))
+#define BIPARTITE_OFFSETS(p) (1 << (2 * BIPARTITE_OUTER_BITS(p)))
+
+// Position of each table in the header of packed tables (see _table_transfer.c)
+#define SIN_COS_TAN_TABLE_ID 0 // This needs to match on CPU and DPU side!
+#define SIN_COS_TAN_OFFSET_TABLE_ID 1 // This needs to match on CPU and DPU side!
+#define EXP_TABLE_ID 2 // This needs to match on CPU and DPU side!
+#define EXP_OFFSET_TABLE_ID 3 // This needs to match on CPU and DPU side!
+#define LOG_TABLE_ID 4 // This needs to match on CPU and DPU side!
+#define LOG_OFFSET_TABLE_ID 5 // This needs to match on CPU and DPU side!
+#define SQRT_TABLE_ID 6 // This needs to match on CPU and DPU side!
+#define SQRT_OFFSET_TABLE_ID 7 // This needs to match on CPU and DPU side!
+
+#define M_PI 3.14159265358979323846 // We use this for some table setups
+
+/*
+ * Parameters of a bipartite table pair, computed once on the host side
+ */
+typedef struct {
+    double (*original)();
+    double lower;
+    double x_granularity_rounded;
+    int outer_bits; // Bits of x0 and x2
+    int middle_bits; // Bits of x1
+} bipartite_parameters;
+
+// Input of the address a (with a fraction for the points between two addresses)
+static double bipartite_x(const bipartite_parameters *p, double address) {
+    return p->lower + (address + 0.5) * p->x_granularity_rounded;
+}
+
+// Fills the entries first to first + count - 1 of the initial values (see _table_transfer.c)
+void fill_initial_values(const void *parameters, void *chunk, int first, int count) {
+    const bipartite_parameters *p = parameters;
+    float *table = chunk;
+    double x2_centre = ldexp(1.0, p->outer_bits - 1) - 0.5;
+
+    for (int i = 0; i < count; ++i) {
+        table[i] = (float) p->original(bipartite_x(p, ldexp(first + i, p->outer_bits) + x2_centre));
+    }
+}
+
+// Fills the entries first to first + count - 1 of the offsets (see _table_transfer.c)
+void fill_offsets(const void *parameters, void *chunk, int first, int count) {
+    const bipartite_parameters *p = parameters;
+    float *table = chunk;
+    double x2_centre = ldexp(1.0, p->outer_bits - 1) - 0.5;
+
+    for (int i = 0; i < count; ++i) {
+        int x0 = (first + i) >> p->outer_bits;
+        int x2 = (first + i) & ((1 << p->outer_bits) - 1);
+        double block = ldexp(ldexp(x0, p->middle_bits) + ldexp(1.0, p->middle_bits - 1), p->outer_bits);
+
+        table[i] = (float) (p->original(bipartite_x(p, block + x2)) - p->original(bipartite_x(p, block + x2_centre)));
+    }
+}
+
+/*
+ * Generates both tables of a function on the host side and broadcasts them to the DPUs in chunks
+ * Inputs
+ * symbol & offset_symbol: names of the tables on the DPU side
+ * table_id & offset_table_id: positions of the tables in the header of packed tables
+ * function: name of the function, used for the on-disk table cache
+ * xLower: Lower end of the table, needs to be a multiple of the spacing
+ * xUpper: Upper end of the table
+ * original(): original function that should be tabularized
+ * precision: address bits
+ *
+ * Outputs
+ * granularity_exponent & lower_address: values that the DPU uses to correctly assign inputs to table addresses
+ */
+void broadcast_bipartite_tables(struct dpu_set_t set, const char *symbol, const char *offset_symbol, int table_id, int offset_table_id,
+                                const char *function, float xLower, float xUpper, double (*original)(), int precision,
+                                int *granularity_exponent, int *lower_address) {
+    bipartite_parameters parameters;
+
+    // Smallest power of 2 spacing with which 2^precision addresses cover [xLower, xUpper]
+    if (frexpf((xUpper - xLower) / (float) (1 << precision), granularity_exponent) == 0.5f) {
+        *granularity_exponent -= 1;
+    }
+    parameters.original = original;
+    parameters.lower = xLower;
+    parameters.x_granularity_rounded = ldexp(1.0, *granularity_exponent);
+    parameters.outer_bits = BIPARTITE_OUTER_BITS(precision);
+    parameters.middle_bits = precision - 2 * parameters.outer_bits;
+    *lower_address = (int) ldexp(xLower, -*granularity_exponent);
+
+    table_disk_cache_key key = {"lut-bipartite", function, BIPARTITE_INITIAL_VALUES(precision), xLower, xUpper, "float32-initial"};
+    broadcast_table(set, symbol, table_id, &key, sizeof(float), BIPARTITE_INITIAL_VALUES(precision), fill_initial_values, &parameters);
+
+    table_disk_cache_key offset_key = {"lut-bipartite", function, BIPARTITE_OFFSETS(precision), xLower, xUpper, "float32-offset"};
+    broadcast_table(set, offset_symbol, offset_table_id, &offset_key, sizeof(float), BIPARTITE_OFFSETS(precision), fill_offsets, &parameters);
+}
+
+// Generates and Broadcasts all tables to the DPU
+void broadcast_tables(struct dpu_set_t set) {
+#ifdef MEASURE
+    double start, end;
+    FILE *out_file = fopen("../microbenchmarks/output/setup.csv", "a");
+    start = clock();
+#endif
+
+#if SIN_COS_TAN_ENABLED > 0
+    int sin_cos_tan_granularity_exponent, sin_cos_tan_lower_address;
+
+    broadcast_bipartite_tables(set, "sin_cos_tan_table", "sin_cos_tan_offset_table", SIN_COS_TAN_TABLE_ID, SIN_COS_TAN_OFFSET_TABLE_ID,
+                               "sin", 0, M_PI/2, sin, SIN_COS_TAN_PRECISION, &sin_cos_tan_granularity_exponent, &sin_cos_tan_lower_address);
+    broadcast_table_parameter(set, "sin_cos_tan_granularity_exponent", SIN_COS_TAN_TABLE_ID, &sin_cos_tan_granularity_exponent);
+#endif
+
+#if EXP_ENABLED > 0
+    int exp_granularity_exponent, exp_lower_address;
+
+    broadcast_bipartite_tables(set, "exp_table", "exp_offset_table", EXP_TABLE_ID, EXP_OFFSET_TABLE_ID,
+                               "exp", 0, log(2), exp, EXP_PRECISION, &exp_granularity_exponent, &exp_lower_address);
+    broadcast_table_parameter(set, "exp_granularity_exponent", EXP_TABLE_ID, &exp_granularity_exponent);
+#endif
+
+#ifdef NOWRAP
+    float mantissa_lower = 0.5, log_upper = 2, sqrt_upper = 2; // Inputs in [0.5, 2)
+#else
+    float mantissa_lower = 1, log_upper = 2, sqrt_upper = 4; // Mantissa in [1, 2) (log) or [1, 4) (sqrt)
+#endif
+
+#if LOG_ENABLED > 0
+    int log_granularity_exponent, log_lower_address;
+
+    broadcast_bipartite_tables(set, "log_table", "log_offset_table", LOG_TABLE_ID, LOG_OFFSET_TABLE_ID,
+                               "log", mantissa_lower, log_upper, log, LOG_PRECISION, &log_granularity_exponent, &log_lower_address);
+    broadcast_table_parameter(set, "log_granularity_exponent", LOG_TABLE_ID, &log_granularity_exponent);
+    broadcast_table_parameter(set, "log_lower_address", LOG_OFFSET_TABLE_ID, &log_lower_address);
+#endif
+
+#if SQRT_ENABLED > 0
+    int sqrt_granularity_exponent, sqrt_lower_address;
+
+    broadcast_bipartite_tables(set, "sqrt_table", "sqrt_offset_table", SQRT_TABLE_ID, SQRT_OFFSET_TABLE_ID,
+                               "sqrt", mantissa_lower, sqrt_upper, sqrt, SQRT_PRECISION, &sqrt_granularity_exponent, &sqrt_lower_address);
+    broadcast_table_parameter(set, "sqrt_granularity_exponent", SQRT_TABLE_ID, &sqrt_granularity_exponent);
+    broadcast_table_parameter(set, "sqrt_lower_address", SQRT_OFFSET_TABLE_ID, &sqrt_lower_address);
+#endif
+
+    table_transfer_finish(set);
+
+#ifdef MEASURE
+    end = clock();
+    printf("Bipartite Setup Time:                     %.2e secs.\n", (end - start) / CLOCKS_PER_SEC );
+    fprintf(out_file, "lut-bipartite_%s, %d, %e\n", storage, PRECISION, (end - start) / CLOCKS_PER_SEC);
+    fclose(out_file);
+#endif
+}
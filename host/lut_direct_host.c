@@ -1,13 +1,44 @@
 #include "math.h"
+#include "_table_transfer.c"
 #ifdef MEASURE
     #include <time.h>
 #endif
 
 // Precision overall - could be externally defined
 #ifndef PRECISION
-#define PRECISION 8 // This needs to match on CPU and DPU side!
+#define PRECISION 10 // This needs to match on CPU and DPU side!
 #endif
 
+// Precision per function - could be externally defined, otherwise derived from PRECISION
+#ifndef TANH_PRECISION
+#define TANH_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
+#ifndef GELU_PRECISION
+#define GELU_PRECISION (PRECISION - 1) // This needs to match on CPU and DPU side!
+#endif
+#ifndef SIN_COS_TAN_PRECISION
+#define SIN_COS_TAN_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
+
+// Functions whose tables are generated and transferred - could be externally defined
+#ifndef ALL_FUNCTIONS_ENABLED
+#define ALL_FUNCTIONS_ENABLED 1 // This needs to match on CPU and DPU side!
+#endif
+#ifndef TANH_ENABLED
+#define TANH_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+#ifndef GELU_ENABLED
+#define GELU_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+#ifndef SIN_COS_TAN_ENABLED
+#define SIN_COS_TAN_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+// Position of each table in the header of packed tables (see _table_transfer.c)
+#define TANH_TABLE_ID 0 // This needs to match on CPU and DPU side!
+#define GELU_TABLE_ID 1 // This needs to match on CPU and DPU side!
+#define SIN_TABLE_ID 2 // This needs to match on CPU and DPU side!
+
 // Values needed to support different float sizes
 #define FLOAT_MANTISSA_BITS 23
 #define FLOAT_EXPONENT_MAKS 0xFF
@@ -24,18 +55,34 @@ float address_to_float(unsigned int in, int precision, int mantissa_size, int mi
     return * (  float  * ) &ret;
 }
 
-// Helper Function
-void fill_table(double (*original)(), float table[], int precision, int mantissa_size, int min_exponent) {
-    for(int i = 0; i < (1<<precision) ; ++i){
-        table[i] = (float) original(address_to_float(i, precision, mantissa_size, min_exponent));
+typedef struct {
+    double (*original)();
+    int precision;
+    int mantissa_size;
+    int min_exponent;
+} table_parameters;
+
+// Helper Function, fills the entries first to first + count - 1 of a table (see _table_transfer.c)
+void fill_table(const void *parameters, void *chunk, int first, int count) {
+    const table_parameters *p = parameters;
+    float *table = chunk;
+
+    for(int i = first; i < first + count ; ++i){
+        table[i - first] = (float) p->original(address_to_float(i, p->precision, p->mantissa_size, p->min_exponent));
     }
 }
 
-// For GeLU, we have to define the function first, gelu_n is just calculating -gelu(x)
-double gelu_p(double x) {
-    return x * 0.5 * (1 + erf(x / sqrt(2)));
+// Helper Function, generates a table and broadcasts it to the DPUs in chunks
+void broadcast_fill_table(struct dpu_set_t set, const char *symbol, int table_id, const char *function, double (*original)(), int precision, int mantissa_size, int min_exponent) {
+    table_parameters parameters = {original, precision, mantissa_size, min_exponent};
+    char format[16];
+    snprintf(format, sizeof(format), "float32-m%d", mantissa_size);
+    table_disk_cache_key key = {"lut-direct", function, 1 << precision, ldexp(1.0, min_exponent), ldexp(1.0, min_exponent + (1 << (precision - mantissa_size))), format};
+
+    broadcast_table(set, symbol, table_id, &key, sizeof(float), 1 << precision, fill_table, &parameters);
 }
 
+// For GeLU, we have to define the function first, gelu_n is gelu(-x): only that half is stored, gelu(x) = x + gelu(-x) (see dpu/_symmetry.c)
 double gelu_n(double x) {
     return - x * 0.5 * (1 + erf(-x / sqrt(2)));
 }
@@ -52,20 +99,19 @@ void broadcast_tables(struct dpu_set_t set) {
     /***********************************************************
     *   TANH
     */
+#if TANH_ENABLED > 0
 
-    #define TANH_PRECISION PRECISION // This needs to match on CPU and DPU side!
-    #define TANH_MANTISSA_SIZE (PRECISION - 3) // This needs to match on CPU and DPU side!
+    #define TANH_MANTISSA_SIZE (TANH_PRECISION - 3) // This needs to match on CPU and DPU side!
     #define TANH_MIN_EXPONENT -4 // This needs to match on CPU and DPU side!
 
-    float tanh_table[1 << TANH_PRECISION];
-    fill_table(tanh, tanh_table, TANH_PRECISION, TANH_MANTISSA_SIZE, TANH_MIN_EXPONENT);
-    DPU_ASSERT(dpu_broadcast_to(set, "tanh_table", 0, &tanh_table, sizeof(tanh_table), DPU_XFER_DEFAULT));
+    broadcast_fill_table(set, "tanh_table", TANH_TABLE_ID, "tanh", tanh, TANH_PRECISION, TANH_MANTISSA_SIZE, TANH_MIN_EXPONENT);
+#endif
 
 #ifdef MEASURE
     // End Timing 1
     end = clock();
     printf("TANH Setup Time:                         %.2e secs.\n", (end - start) / CLOCKS_PER_SEC );
-    fprintf(out_file, "lut-direct_%s_tanh, %d, %e\n", storage, PRECISION, (end - start) / CLOCKS_PER_SEC);
+    fprintf(out_file, "lut-direct_%s_tanh, %d, %e\n", storage, TANH_PRECISION, (end - start) / CLOCKS_PER_SEC);
 
     // Start Timing 2
     start = clock();
@@ -74,50 +120,42 @@ void broadcast_tables(struct dpu_set_t set) {
     /***********************************************************
     *   GELU
     */
+#if GELU_ENABLED > 0
 
     // Address generation function parameters
-    #define GELU_PRECISION (PRECISION - 1) // This needs to match on CPU and DPU side!
-    #define GELU_MANTISSA_SIZE (PRECISION - 4) // This needs to match on CPU and DPU side!
+    #define GELU_MANTISSA_SIZE (GELU_PRECISION - 3) // This needs to match on CPU and DPU side!
     #define GELU_MIN_EXPONENT -4 // This needs to match on CPU and DPU side!
 
-    float gelu_table_p[1 << GELU_PRECISION];
-    float gelu_table_n[1 << GELU_PRECISION];
-
-
-    fill_table(gelu_p, gelu_table_p, GELU_PRECISION, GELU_MANTISSA_SIZE, GELU_MIN_EXPONENT);
-    fill_table(gelu_n, gelu_table_n, GELU_PRECISION, GELU_MANTISSA_SIZE, GELU_MIN_EXPONENT);
-
-    DPU_ASSERT(dpu_broadcast_to(set, "gelu_table_p", 0, &gelu_table_p, sizeof(gelu_table_p), DPU_XFER_DEFAULT));
-    DPU_ASSERT(dpu_broadcast_to(set, "gelu_table_n", 0, &gelu_table_n, sizeof(gelu_table_n), DPU_XFER_DEFAULT));
+    broadcast_fill_table(set, "gelu_table", GELU_TABLE_ID, "gelu_n", gelu_n, GELU_PRECISION, GELU_MANTISSA_SIZE, GELU_MIN_EXPONENT);
+#endif
 
 #ifdef MEASURE
     // End Timing 2
     end = clock();
     printf("GELU Setup Time:                         %.2e secs.\n", (end - start) / CLOCKS_PER_SEC );
-    fprintf(out_file, "lut-direct_%s_gelu, %d, %e\n", storage, PRECISION, (end - start) / CLOCKS_PER_SEC);
+    fprintf(out_file, "lut-direct_%s_gelu, %d, %e\n", storage, GELU_PRECISION, (end - start) / CLOCKS_PER_SEC);
 #endif
 
   /***********************************************************
   *   SIN
   */
+#if SIN_COS_TAN_ENABLED > 0
 
-  #define SIN_COS_TAN_PRECISION PRECISION // This needs to match on CPU and DPU side!
-  #define SIN_COS_TAN_MANTISSA_SIZE (PRECISION - 3) // This needs to match on CPU and DPU side!
+  #define SIN_COS_TAN_MANTISSA_SIZE (SIN_COS_TAN_PRECISION - 3) // This needs to match on CPU and DPU side!
   #define SIN_COS_TAN_MIN_EXPONENT -7 // This needs to match on CPU and DPU side!
 
-    float sin_table[1 << SIN_COS_TAN_PRECISION];
-    fill_table(sin, sin_table, SIN_COS_TAN_PRECISION, SIN_COS_TAN_MANTISSA_SIZE, SIN_COS_TAN_MIN_EXPONENT);
-
-    DPU_ASSERT(dpu_broadcast_to(set, "sin_table", 0, &sin_table, sizeof(sin_table), DPU_XFER_DEFAULT));
+    broadcast_fill_table(set, "sin_table", SIN_TABLE_ID, "sin", sin, SIN_COS_TAN_PRECISION, SIN_COS_TAN_MANTISSA_SIZE, SIN_COS_TAN_MIN_EXPONENT);
+#endif
 
 #ifdef MEASURE
   // End Timing 1
     end = clock();
     printf("SIN Setup Time:                         %.2e secs.\n", (end - start) / CLOCKS_PER_SEC );
-    fprintf(out_file, "lut-direct_%s_sin, %d, %e\n", storage, PRECISION, (end - start) / CLOCKS_PER_SEC);
+    fprintf(out_file, "lut-direct_%s_sin, %d, %e\n", storage, SIN_COS_TAN_PRECISION, (end - start) / CLOCKS_PER_SEC);
 
     // Start Timing 2
     start = clock();
 #endif
 
+    table_transfer_finish(set);
 }
@@ -1,4 +1,6 @@
 #include <math.h>
+#include "_table_transfer.c"
+#include "_compressed_tables.c"
 #ifdef MEASURE
     #include <time.h>
 #endif
@@ -8,41 +10,203 @@
 #define PRECISION 10 // This needs to match on CPU and DPU side!
 #endif
 
+// Precision per function - could be externally defined, otherwise derived from PRECISION
+#ifndef SIN_COS_TAN_PRECISION
+#define SIN_COS_TAN_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
+#ifndef SINH_COSH_TANH_PRECISION
+#define SINH_COSH_TANH_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
+#ifndef EXP_PRECISION
+#define EXP_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
+#ifndef LOG_PRECISION
+#define LOG_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
+#ifndef SQRT_PRECISION
+#define SQRT_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
+#ifndef CNDF_PRECISION
+#define CNDF_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
+
+// Functions whose tables are generated and transferred - could be externally defined
+#ifndef ALL_FUNCTIONS_ENABLED
+#define ALL_FUNCTIONS_ENABLED 1 // This needs to match on CPU and DPU side!
+#endif
+#ifndef SIN_COS_TAN_ENABLED
+#define SIN_COS_TAN_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+#ifndef SINH_COSH_TANH_ENABLED
+#define SINH_COSH_TANH_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+#ifndef EXP_ENABLED
+#define EXP_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+#ifndef LOG_ENABLED
+#define LOG_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+#ifndef SQRT_ENABLED
+#define SQRT_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+#ifndef CNDF_ENABLED
+#define CNDF_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+// Tables in fixed point for the integer interpolation of lut_ldexpf_interpolate.c - could be externally defined
+#ifndef INTEGER_INTERPOLATION
+#define INTEGER_INTERPOLATION 0 // This needs to match on CPU and DPU side!
+#endif
+#ifndef FIXED_FRACTION_BITS
+#define FIXED_FRACTION_BITS 28 // This needs to match on CPU and DPU side!
+#endif
+
+// Every entry followed by the difference to the next one, for lut_ldexpf_interpolate.c (see dpu/_table_cache.c) - could be externally defined
+#ifndef INTERLEAVED_TABLES
+#define INTERLEAVED_TABLES 0 // This needs to match on CPU and DPU side!
+#endif
+
+// Tables with 16 bit entries, for lut_ldexpf_interpolate.c (see dpu/_compressed_tables.c) - could be externally defined
+#ifndef COMPRESSED_TABLES
+#define COMPRESSED_TABLES 0 // This needs to match on CPU and DPU side!
+#endif
+
+// Position of each table in the header of packed tables (see _table_transfer.c)
+#define SIN_COS_TAN_TABLE_ID 0 // This needs to match on CPU and DPU side!
+#define SINH_TABLE_ID 1 // This needs to match on CPU and DPU side!
+#define COSH_TABLE_ID 2 // This needs to match on CPU and DPU side!
+#define EXP_TABLE_ID 3 // This needs to match on CPU and DPU side!
+#define LOG_TABLE_ID 4 // This needs to match on CPU and DPU side!
+#define SQRT_TABLE_ID 5 // This needs to match on CPU and DPU side!
+#define CNDF_TABLE_ID 6 // This needs to match on CPU and DPU side!
+
 int _unused_zero_address; // For some LUTs it is not needed to save the zero address (because it is zero anyway, in that case, we just point to this value)
 
 #define M_PI 3.14159265358979323846 // We use this for some table setups
 
-// Function for cndf
+// Function for cndf, cndf_n is cndf(-x): only that half is stored, cndf(x) = 1 - cndf(-x) (see dpu/_symmetry.c)
 # define M_SQRT1_2	0.70710678118654752440	/* 1/sqrt(2) */
-double cndf(double value)
+double cndf_n(double value)
 {
-    return ldexp(erfc(-value * M_SQRT1_2), -1);
+    return ldexp(erfc(value * M_SQRT1_2), -1);
 }
 
 /*
- * Fills a table on the host side and makes it ready to transmit
+ * Parameters of a table, computed once on the host side
+ */
+typedef struct {
+    double (*original)();
+    float x_granularity_rounded;
+    int zero_address;
+} table_parameters;
+
+// Fills the entries first to first + count - 1 of a table (see _table_transfer.c)
+void fill_table(const void *parameters, void *chunk, int first, int count) {
+    const table_parameters *p = parameters;
+    float *table = chunk;
+
+    for(int i = 0; i<count; ++i){
+        table[i] = (float) p->original(p->x_granularity_rounded * (first + i - p->zero_address));
+    }
+}
+
+// Fixed point value of the entry at index, values beyond the fixed point range (e.g. log(0)) are saturated
+static int32_t fixed_table_entry(const table_parameters *p, int index) {
+    double value = floor(ldexp(p->original(p->x_granularity_rounded * (index - p->zero_address)), FIXED_FRACTION_BITS) + 0.5);
+    return value >= INT32_MAX ? INT32_MAX : value <= INT32_MIN ? INT32_MIN : (int32_t) value;
+}
+
+// Fixed point version of fill_table()
+void fill_table_fixed(const void *parameters, void *chunk, int first, int count) {
+    const table_parameters *p = parameters;
+    int32_t *table = chunk;
+
+    for(int i = 0; i<count; ++i){
+        table[i] = fixed_table_entry(p, first + i);
+    }
+}
+
+// Interleaved version of fill_table(): every entry is followed by the difference to the next one
+void fill_table_interleaved(const void *parameters, void *chunk, int first, int count) {
+    const table_parameters *p = parameters;
+    float *table = chunk;
+    float next = (float) p->original(p->x_granularity_rounded * (first - p->zero_address));
+
+    for(int i = 0; i<count; ++i){
+        float value = next;
+        next = (float) p->original(p->x_granularity_rounded * (first + i + 1 - p->zero_address));
+        table[2 * i] = value;
+        table[2 * i + 1] = next - value;
+    }
+}
+
+// Interleaved version of fill_table_fixed(), the difference wraps around like the subtraction on the DPU side
+void fill_table_fixed_interleaved(const void *parameters, void *chunk, int first, int count) {
+    const table_parameters *p = parameters;
+    int32_t *table = chunk;
+    int32_t next = fixed_table_entry(p, first);
+
+    for(int i = 0; i<count; ++i){
+        int32_t value = next;
+        next = fixed_table_entry(p, first + i + 1);
+        table[2 * i] = value;
+        table[2 * i + 1] = (int32_t) ((uint32_t) next - (uint32_t) value);
+    }
+}
+
+// Value of the entry at index, for compressed tables (see _compressed_tables.c)
+double table_value(const void *parameters, int index) {
+    const table_parameters *p = parameters;
+    return p->original(p->x_granularity_rounded * (index - p->zero_address));
+}
+
+/*
+ * Generates a table on the host side and broadcasts it to the DPUs in chunks
  * Inputs
+ * symbol: name of the table on the DPU side
+ * table_id: position of the table in the header of packed tables
+ * function: name of the function, used for the on-disk table cache
  * xLower: Lower end of the table
  * xUpper: Upper end of the table
  * original(): original function that should be tabularized
+ * size: array size (in entries)
  *
  * Outputs
- * size: array size (in entries)
- * table[]: Array to use for the table
  * zero_address & granularity_exponent: values that the DPU uses to correctly assign inputs to table addresses
  */
-void fill_table(float xLower, float xUpper, double (*original)(), int size, float table[], int *zero_address, int *granularity_exponent) {
+void broadcast_fill_table(struct dpu_set_t set, const char *symbol, int table_id, const char *function, float xLower, float xUpper, double (*original)(), int size, int *zero_address, int *granularity_exponent) {
     float x_granularity = (xUpper - xLower) / (float) size;
+    table_parameters parameters;
 
     frexpf(x_granularity, granularity_exponent);
 
     // From that exponent figure out the best possible spacing in x
-    float x_granularity_rounded = ldexpf(1.0f, *granularity_exponent);
-    *zero_address = (int) (-xLower / (xUpper - xLower) * size);
-
-    for(int i = 0; i<size; ++i){
-        table[i] = (float) original(x_granularity_rounded * (i - *zero_address));
-    }
+    parameters.original = original;
+    parameters.x_granularity_rounded = ldexpf(1.0f, *granularity_exponent);
+    parameters.zero_address = (int) (-xLower / (xUpper - xLower) * size);
+    *zero_address = parameters.zero_address;
+
+#if INTEGER_INTERPOLATION > 0 && defined LUT_LDEXPF_INTERPOLATE
+    char format[32];
+#if INTERLEAVED_TABLES > 0
+    snprintf(format, sizeof(format), "fixed%d-interleaved", FIXED_FRACTION_BITS);
+    table_disk_cache_key key = {"lut-ldexpf", function, size, xLower, xUpper, format};
+    broadcast_table(set, symbol, table_id, &key, 2 * sizeof(int32_t), size, fill_table_fixed_interleaved, &parameters);
+#else
+    snprintf(format, sizeof(format), "fixed%d", FIXED_FRACTION_BITS);
+    table_disk_cache_key key = {"lut-ldexpf", function, size, xLower, xUpper, format};
+    broadcast_table(set, symbol, table_id, &key, sizeof(int32_t), size, fill_table_fixed, &parameters);
+#endif
+#elif COMPRESSED_TABLES > 0 && defined LUT_LDEXPF_INTERPOLATE
+    table_disk_cache_key key = {"lut-ldexpf", function, size, xLower, xUpper, NULL};
+    broadcast_compressed_table(set, symbol, table_id, &key, size, table_value, &parameters);
+#elif INTERLEAVED_TABLES > 0 && defined LUT_LDEXPF_INTERPOLATE
+    table_disk_cache_key key = {"lut-ldexpf", function, size, xLower, xUpper, "float32-interleaved"};
+    broadcast_table(set, symbol, table_id, &key, 2 * sizeof(float), size, fill_table_interleaved, &parameters);
+#else
+    table_disk_cache_key key = {"lut-ldexpf", function, size, xLower, xUpper, "float32"};
+    broadcast_table(set, symbol, table_id, &key, sizeof(float), size, fill_table, &parameters);
+#endif
 }
 
 // Generates and Broadcasts all tables to the DPU
@@ -57,19 +221,18 @@ void broadcast_tables(struct dpu_set_t set) {
     /***********************************************************
     *   SIN / COS / TAN
     */
-    #define SIN_COS_TAN_PRECISION PRECISION // This needs to match on CPU and DPU side!
-    float sin_cos_tan_table[1 << SIN_COS_TAN_PRECISION];
+#if SIN_COS_TAN_ENABLED > 0
     int sin_cos_tan_granularity_exponent;
 
-    fill_table(0, M_PI/2, sin, 1 << SIN_COS_TAN_PRECISION, sin_cos_tan_table, &_unused_zero_address, &sin_cos_tan_granularity_exponent);
-    DPU_ASSERT(dpu_broadcast_to(set, "sin_cos_tan_table", 0, &sin_cos_tan_table, sizeof(sin_cos_tan_table), DPU_XFER_DEFAULT));
-    DPU_ASSERT(dpu_broadcast_to(set, "sin_cos_tan_granularity_exponent", 0, &sin_cos_tan_granularity_exponent, sizeof(sin_cos_tan_granularity_exponent), DPU_XFER_DEFAULT));
+    broadcast_fill_table(set, "sin_cos_tan_table", SIN_COS_TAN_TABLE_ID, "sin", 0, M_PI/2, sin, 1 << SIN_COS_TAN_PRECISION, &_unused_zero_address, &sin_cos_tan_granularity_exponent);
+    broadcast_table_parameter(set, "sin_cos_tan_granularity_exponent", SIN_COS_TAN_TABLE_ID, &sin_cos_tan_granularity_exponent);
+#endif
 
 #ifdef MEASURE
     // End Timing 1
     end = clock();
     printf("SIN COS TAN Setup Time:                   %.2e secs.\n", (end - start) / CLOCKS_PER_SEC );
-    fprintf(out_file, "lut-ldexpf_%s_sin-cos-tan, %d, %e\n", storage, PRECISION, (end - start) / CLOCKS_PER_SEC);
+    fprintf(out_file, "lut-ldexpf_%s_sin-cos-tan, %d, %e\n", storage, SIN_COS_TAN_PRECISION, (end - start) / CLOCKS_PER_SEC);
 
     // Start Timing 2
     start = clock();
@@ -78,20 +241,20 @@ void broadcast_tables(struct dpu_set_t set) {
     /***********************************************************
     *   SINH / COSH / TANH
     */
-    #define SINH_COSH_TANH_PRECISION PRECISION // This needs to match on CPU and DPU side!
-    float sinh_table[1 << SINH_COSH_TANH_PRECISION];
-    float cosh_table[1 << SINH_COSH_TANH_PRECISION];
+#if SINH_COSH_TANH_ENABLED > 0
     int sinh_cosh_tanh_granularity_exponent;
 
-    DPU_ASSERT(dpu_broadcast_to(set, "sinh_table", 0, &sinh_table, sizeof(sinh_table), DPU_XFER_DEFAULT));
-    DPU_ASSERT(dpu_broadcast_to(set, "cosh_table", 0, &cosh_table, sizeof(cosh_table), DPU_XFER_DEFAULT));
-    DPU_ASSERT(dpu_broadcast_to(set, "sinh_cosh_tanh_granularity_exponent", 0, &sinh_cosh_tanh_granularity_exponent, sizeof(sinh_cosh_tanh_granularity_exponent), DPU_XFER_DEFAULT));
+    // sinh and cosh share the parameters, both tables span the reduced range of exp
+    broadcast_fill_table(set, "sinh_table", SINH_TABLE_ID, "sinh", 0, log(2), sinh, 1 << SINH_COSH_TANH_PRECISION, &_unused_zero_address, &sinh_cosh_tanh_granularity_exponent);
+    broadcast_fill_table(set, "cosh_table", COSH_TABLE_ID, "cosh", 0, log(2), cosh, 1 << SINH_COSH_TANH_PRECISION, &_unused_zero_address, &sinh_cosh_tanh_granularity_exponent);
+    broadcast_table_parameter(set, "sinh_cosh_tanh_granularity_exponent", SINH_TABLE_ID, &sinh_cosh_tanh_granularity_exponent);
+#endif
 
 #ifdef MEASURE
     // End Timing 2
     end = clock();
     printf("SINH COSH TANH Setup Time:                %.2e secs.\n", (end - start) / CLOCKS_PER_SEC );
-    fprintf(out_file, "lut-ldexpf_%s_sinh-cosh-tanh, %d, %e\n", storage, PRECISION, (end - start) / CLOCKS_PER_SEC);
+    fprintf(out_file, "lut-ldexpf_%s_sinh-cosh-tanh, %d, %e\n", storage, SINH_COSH_TANH_PRECISION, (end - start) / CLOCKS_PER_SEC);
 
     // Start Timing 3
     start = clock();
@@ -100,19 +263,18 @@ void broadcast_tables(struct dpu_set_t set) {
     /***********************************************************
     *   EXP
     */
-    #define EXP_PRECISION PRECISION // This needs to match on CPU and DPU side!
-    float exp_table[1 << EXP_PRECISION];
+#if EXP_ENABLED > 0
     int exp_granularity_exponent;
 
-    fill_table(0, log(2), exp, 1 << EXP_PRECISION, exp_table, &_unused_zero_address, &exp_granularity_exponent);
-    DPU_ASSERT(dpu_broadcast_to(set, "exp_table", 0, &exp_table, sizeof(exp_table), DPU_XFER_DEFAULT));
-    DPU_ASSERT(dpu_broadcast_to(set, "exp_granularity_exponent", 0, &exp_granularity_exponent, sizeof(exp_granularity_exponent), DPU_XFER_DEFAULT));
+    broadcast_fill_table(set, "exp_table", EXP_TABLE_ID, "exp", 0, log(2), exp, 1 << EXP_PRECISION, &_unused_zero_address, &exp_granularity_exponent);
+    broadcast_table_parameter(set, "exp_granularity_exponent", EXP_TABLE_ID, &exp_granularity_exponent);
+#endif
 
 #ifdef MEASURE
     // End Timing 3
     end = clock();
     printf("EXP Setup Time:                           %.2e secs.\n", (end - start) / CLOCKS_PER_SEC );
-    fprintf(out_file, "lut-ldexpf_%s_exp, %d, %e\n", storage, PRECISION, (end - start) / CLOCKS_PER_SEC);
+    fprintf(out_file, "lut-ldexpf_%s_exp, %d, %e\n", storage, EXP_PRECISION, (end - start) / CLOCKS_PER_SEC);
 
     // Start Timing 4
     start = clock();
@@ -121,19 +283,18 @@ void broadcast_tables(struct dpu_set_t set) {
     /***********************************************************
     *   LOG
     */
-    #define LOG_PRECISION PRECISION // This needs to match on CPU and DPU side!
-    float log_table[1 << LOG_PRECISION];
+#if LOG_ENABLED > 0
     int log_granularity_exponent;
 
-    fill_table(0, 2, log, 1 << LOG_PRECISION, log_table, &_unused_zero_address, &log_granularity_exponent);
-    DPU_ASSERT(dpu_broadcast_to(set, "log_table", 0, &log_table, sizeof(log_table), DPU_XFER_DEFAULT));
-    DPU_ASSERT(dpu_broadcast_to(set, "log_granularity_exponent", 0, &log_granularity_exponent, sizeof(log_granularity_exponent), DPU_XFER_DEFAULT));
+    broadcast_fill_table(set, "log_table", LOG_TABLE_ID, "log", 0, 2, log, 1 << LOG_PRECISION, &_unused_zero_address, &log_granularity_exponent);
+    broadcast_table_parameter(set, "log_granularity_exponent", LOG_TABLE_ID, &log_granularity_exponent);
+#endif
 
 #ifdef MEASURE
     // End Timing 4
     end = clock();
     printf("LOG Setup Time:                           %.2e secs.\n", (end - start) / CLOCKS_PER_SEC );
-    fprintf(out_file, "lut-ldexpf_%s_log, %d, %e\n", storage, PRECISION, (end - start) / CLOCKS_PER_SEC);
+    fprintf(out_file, "lut-ldexpf_%s_log, %d, %e\n", storage, LOG_PRECISION, (end - start) / CLOCKS_PER_SEC);
 
     // Start Timing 5
     start = clock();
@@ -142,20 +303,20 @@ void broadcast_tables(struct dpu_set_t set) {
     /***********************************************************
     *   SQRT
     */
-    #define SQRT_PRECISION PRECISION // This needs to match on CPU and DPU side!
-    float sqrt_table[1 << SQRT_PRECISION];
+#if SQRT_ENABLED > 0
     int sqrt_granularity_exponent;
 
-    fill_table(0, 9, sqrt, 1 << SQRT_PRECISION, sqrt_table, &_unused_zero_address, &sqrt_granularity_exponent);
-    DPU_ASSERT(dpu_broadcast_to(set, "sqrt_table", 0, &sqrt_table, sizeof(sqrt_table), DPU_XFER_DEFAULT));
-    DPU_ASSERT(dpu_broadcast_to(set, "sqrt_granularity_exponent", 0, &sqrt_granularity_exponent, sizeof(sqrt_granularity_exponent), DPU_XFER_DEFAULT));
+    broadcast_fill_table(set, "sqrt_table", SQRT_TABLE_ID, "sqrt", 0, 9, sqrt, 1 << SQRT_PRECISION, &_unused_zero_address, &sqrt_granularity_exponent);
+    broadcast_table_parameter(set, "sqrt_granularity_exponent", SQRT_TABLE_ID, &sqrt_granularity_exponent);
+#endif
+
 
 
 #ifdef MEASURE
     // End Timing 5
     end = clock();
     printf("SQRT Setup Time:                          %.2e secs.\n", (end - start) / CLOCKS_PER_SEC );
-    fprintf(out_file, "lut-ldexpf_%s_sqrt, %d, %e\n", storage, PRECISION, (end - start) / CLOCKS_PER_SEC);
+    fprintf(out_file, "lut-ldexpf_%s_sqrt, %d, %e\n", storage, SQRT_PRECISION, (end - start) / CLOCKS_PER_SEC);
 
     // Start Timing 6
     start = clock();
@@ -165,19 +326,21 @@ void broadcast_tables(struct dpu_set_t set) {
     /***********************************************************
     *   CNDF
     */
-    #define CNDF_PRECISION PRECISION // This needs to match on CPU and DPU side!
-    float cndf_table[1 << CNDF_PRECISION];
+#if CNDF_ENABLED > 0
     int cndf_granularity_exponent;
 
-    fill_table(0, 9, cndf, 1 << CNDF_PRECISION, cndf_table, &_unused_zero_address, &cndf_granularity_exponent);
-    DPU_ASSERT(dpu_broadcast_to(set, "cndf_table", 0, &cndf_table, sizeof(cndf_table), DPU_XFER_DEFAULT));
-    DPU_ASSERT(dpu_broadcast_to(set, "cndf_granularity_exponent", 0, &cndf_granularity_exponent, sizeof(cndf_granularity_exponent), DPU_XFER_DEFAULT));
+    broadcast_fill_table(set, "cndf_table", CNDF_TABLE_ID, "cndf_n", 0, 9, cndf_n, 1 << CNDF_PRECISION, &_unused_zero_address, &cndf_granularity_exponent);
+    broadcast_table_parameter(set, "cndf_granularity_exponent", CNDF_TABLE_ID, &cndf_granularity_exponent);
+#endif
+
 #endif
 
 #ifdef MEASURE
     // End Timing 6
     end = clock();
     printf("CNDF Setup Time:                          %.2e secs.\n", (end - start) / CLOCKS_PER_SEC );
-    fprintf(out_file, "lut-ldexpf_%s_sqrt, %d, %e\n", storage, PRECISION, (end - start) / CLOCKS_PER_SEC);
+    fprintf(out_file, "lut-ldexpf_%s_cndf, %d, %e\n", storage, CNDF_PRECISION, (end - start) / CLOCKS_PER_SEC);
 #endif
+
+    table_transfer_finish(set);
 }
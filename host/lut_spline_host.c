@@ -0,0 +1,202 @@
+#include <math.h>
+#include "_table_transfer.c"
+#ifdef MEASURE
+    #include <time.h>
+#endif
+
+/*
+ * Host side of the spline LUT (lut_spline.c)
+ *
+ * Every segment of a table covers one table spacing (a power of 2, like for lut_ldexpf).
+ * Its polynomial interpolates the function at SPLINE_DEGREE + 1 Chebyshev nodes of the segment,
+ * which is close to the minimax polynomial of the segment and only needs function values.
+ */
+
+// Precision overall - could be externally defined
+#ifndef PRECISION
+#define PRECISION 6 // This needs to match on CPU and DPU side!
+#endif
+
+#ifndef SPLINE_DEGREE
+#define SPLINE_DEGREE 3 // This needs to match on CPU and DPU side!
+#endif
+
+#define SPLINE_STRIDE 4 // This needs to match on CPU and DPU side!
+
+// Precision per function - could be externally defined, otherwise derived from PRECISION
+#ifndef SIN_COS_TAN_PRECISION
+#define SIN_COS_TAN_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
+#ifndef EXP_PRECISION
+#define EXP_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
+#ifndef LOG_PRECISION
+#define LOG_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
+#ifndef SQRT_PRECISION
+#define SQRT_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
+#ifndef CNDF_PRECISION
+#define CNDF_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
+
+// Functions whose tables are generated and transferred - could be externally defined
+#ifndef ALL_FUNCTIONS_ENABLED
+#define ALL_FUNCTIONS_ENABLED 1 // This needs to match on CPU and DPU side!
+#endif
+#ifndef SIN_COS_TAN_ENABLED
+#define SIN_COS_TAN_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+#ifndef EXP_ENABLED
+#define EXP_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+#ifndef LOG_ENABLED
+#define LOG_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+#ifndef SQRT_ENABLED
+#define SQRT_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+#ifndef CNDF_ENABLED
+#define CNDF_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+// Position of each table in the header of packed tables (see _table_transfer.c)
+#define SIN_COS_TAN_TABLE_ID 0 // This needs to match on CPU and DPU side!
+#define EXP_TABLE_ID 3 // This needs to match on CPU and DPU side!
+#define LOG_TABLE_ID 4 // This needs to match on CPU and DPU side!
+#define SQRT_TABLE_ID 5 // This needs to match on CPU and DPU side!
+#define CNDF_TABLE_ID 6 // This needs to match on CPU and DPU side!
+
+#define M_PI 3.14159265358979323846 // We use this for some table setups
+
+// Function for cndf, cndf_n is cndf(-x): only that half is stored, cndf(x) = 1 - cndf(-x) (see dpu/_symmetry.c)
+# define M_SQRT1_2	0.70710678118654752440	/* 1/sqrt(2) */
+double cndf_n(double value)
+{
+    return ldexp(erfc(value * M_SQRT1_2), -1);
+}
+
+/*
+ * Parameters of a spline table, computed once on the host side
+ */
+typedef struct {
+    double (*original)();
+    double x_granularity_rounded;
+} spline_parameters;
+
+// Fills the segments first to first + count - 1 of a table (see _table_transfer.c)
+void fill_spline_table(const void *parameters, void *chunk, int first, int count) {
+    const spline_parameters *p = parameters;
+    float *table = chunk;
+    int n = SPLINE_DEGREE + 1;
+
+    for (int i = 0; i < count; ++i) {
+        double nodes[SPLINE_DEGREE + 1], c[SPLINE_DEGREE + 1], monomial[SPLINE_STRIDE] = {0};
+
+        // Chebyshev nodes in [0, 1], the local variable of the segment
+        for (int k = 0; k < n; k++) {
+            nodes[k] = 0.5 - 0.5 * cos(M_PI * (2 * k + 1) / (2 * n));
+            c[k] = p->original(p->x_granularity_rounded * (first + i + nodes[k]));
+        }
+
+        // Divided differences, then the Newton form is expanded into c[0] + c[1] * t + ...
+        for (int level = 1; level < n; level++) {
+            for (int k = n - 1; k >= level; k--) {
+                c[k] = (c[k] - c[k - 1]) / (nodes[k] - nodes[k - level]);
+            }
+        }
+        for (int k = n - 1; k >= 0; k--) {
+            for (int j = n - 1; j > 0; j--) {
+                monomial[j] = monomial[j - 1] - nodes[k] * monomial[j];
+            }
+            monomial[0] = c[k] - nodes[k] * monomial[0];
+        }
+
+        for (int k = 0; k < SPLINE_STRIDE; k++) {
+            table[SPLINE_STRIDE * i + k] = (float) monomial[k];
+        }
+    }
+}
+
+/*
+ * Generates a spline table on the host side and broadcasts it to the DPUs in chunks
+ * Inputs
+ * symbol: name of the table on the DPU side
+ * table_id: position of the table in the header of packed tables
+ * function: name of the function, used for the on-disk table cache
+ * xUpper: Upper end of the table (the lower end is 0)
+ * original(): original function that should be tabularized
+ * size: number of segments
+ *
+ * Outputs
+ * granularity_exponent: value that the DPU uses to correctly assign inputs to segments
+ */
+void broadcast_spline_table(struct dpu_set_t set, const char *symbol, int table_id, const char *function, float xUpper, double (*original)(), int size, int *granularity_exponent) {
+    spline_parameters parameters;
+
+    // Smallest power of 2 spacing with which size segments cover [0, xUpper]
+    if (frexpf(xUpper / (float) size, granularity_exponent) == 0.5f) {
+        *granularity_exponent -= 1;
+    }
+    parameters.original = original;
+    parameters.x_granularity_rounded = ldexp(1.0, *granularity_exponent);
+
+    char format[] = "float32-degree0";
+    format[sizeof(format) - 2] = (char) ('0' + SPLINE_DEGREE);
+
+    table_disk_cache_key key = {"lut-spline", function, size, 0, xUpper, format};
+    broadcast_table(set, symbol, table_id, &key, sizeof(float) * SPLINE_STRIDE, size, fill_spline_table, &parameters);
+}
+
+// Generates and Broadcasts all tables to the DPU
+void broadcast_tables(struct dpu_set_t set) {
+#ifdef MEASURE
+    double start, end;
+    FILE *out_file = fopen("../microbenchmarks/output/setup.csv", "a");
+    start = clock();
+#endif
+
+#if SIN_COS_TAN_ENABLED > 0
+    int sin_cos_tan_granularity_exponent;
+
+    broadcast_spline_table(set, "sin_cos_tan_table", SIN_COS_TAN_TABLE_ID, "sin", M_PI/2, sin, 1 << SIN_COS_TAN_PRECISION, &sin_cos_tan_granularity_exponent);
+    broadcast_table_parameter(set, "sin_cos_tan_granularity_exponent", SIN_COS_TAN_TABLE_ID, &sin_cos_tan_granularity_exponent);
+#endif
+
+#if EXP_ENABLED > 0
+    int exp_granularity_exponent;
+
+    broadcast_spline_table(set, "exp_table", EXP_TABLE_ID, "exp", log(2), exp, 1 << EXP_PRECISION, &exp_granularity_exponent);
+    broadcast_table_parameter(set, "exp_granularity_exponent", EXP_TABLE_ID, &exp_granularity_exponent);
+#endif
+
+#if LOG_ENABLED > 0
+    int log_granularity_exponent;
+
+    broadcast_spline_table(set, "log_table", LOG_TABLE_ID, "log", 2, log, 1 << LOG_PRECISION, &log_granularity_exponent);
+    broadcast_table_parameter(set, "log_granularity_exponent", LOG_TABLE_ID, &log_granularity_exponent);
+#endif
+
+#if SQRT_ENABLED > 0
+    int sqrt_granularity_exponent;
+
+    broadcast_spline_table(set, "sqrt_table", SQRT_TABLE_ID, "sqrt", 4, sqrt, 1 << SQRT_PRECISION, &sqrt_granularity_exponent);
+    broadcast_table_parameter(set, "sqrt_granularity_exponent", SQRT_TABLE_ID, &sqrt_granularity_exponent);
+#endif
+
+#if CNDF_ENABLED > 0
+    int cndf_granularity_exponent;
+
+    broadcast_spline_table(set, "cndf_table", CNDF_TABLE_ID, "cndf_n", 9, cndf_n, 1 << CNDF_PRECISION, &cndf_granularity_exponent);
+    broadcast_table_parameter(set, "cndf_granularity_exponent", CNDF_TABLE_ID, &cndf_granularity_exponent);
+#endif
+
+    table_transfer_finish(set);
+
+#ifdef MEASURE
+    end = clock();
+    printf("Spline Setup Time:                        %.2e secs.\n", (end - start) / CLOCKS_PER_SEC );
+    fprintf(out_file, "lut-spline_%s, %d, %e\n", storage, PRECISION, (end - start) / CLOCKS_PER_SEC);
+    fclose(out_file);
+#endif
+}
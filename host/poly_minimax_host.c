@@ -0,0 +1,320 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#ifdef MEASURE
+    #include <time.h>
+#endif
+
+/*
+ * Host side of the polynomial methods (poly_minimax.c and poly_minimax_fixed.c, the latter with -D POLY_MINIMAX_FIXED)
+ *
+ * For every function, a polynomial of degree <NAME>_PRECISION is fitted to the function over its reduced input range
+ * with the Remez exchange algorithm, so that the largest absolute error over the range is minimal (minimax).
+ * The coefficients are broadcast to WRAM, which is all the setup these methods need.
+ */
+
+// Degree overall - could be externally defined
+#ifndef PRECISION
+#define PRECISION 7 // This needs to match on CPU and DPU side!
+#endif
+
+// Degree per function - could be externally defined, otherwise derived from PRECISION
+#ifndef SIN_COS_TAN_PRECISION
+#define SIN_COS_TAN_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
+#ifndef EXP_PRECISION
+#define EXP_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
+#ifndef LOG_PRECISION
+#define LOG_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
+#ifndef SQRT_PRECISION
+#define SQRT_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
+#ifndef CNDF_PRECISION
+#define CNDF_PRECISION PRECISION // This needs to match on CPU and DPU side!
+#endif
+
+// Functions whose coefficients are generated and transferred - could be externally defined
+#ifndef ALL_FUNCTIONS_ENABLED
+#define ALL_FUNCTIONS_ENABLED 1 // This needs to match on CPU and DPU side!
+#endif
+#ifndef SIN_COS_TAN_ENABLED
+#define SIN_COS_TAN_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+#ifndef EXP_ENABLED
+#define EXP_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+#ifndef LOG_ENABLED
+#define LOG_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+#ifndef SQRT_ENABLED
+#define SQRT_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+#ifndef CNDF_ENABLED
+#define CNDF_ENABLED ALL_FUNCTIONS_ENABLED // This needs to match on CPU and DPU side!
+#endif
+
+#define POLY_MAX_DEGREE 15 // This needs to match on CPU and DPU side!
+#define CNDF_POLY_RANGE 5.0 // This needs to match on CPU and DPU side!
+
+// Number of pieces cndf is split into over [0, CNDF_POLY_RANGE] - could be externally defined
+#ifndef CNDF_POLY_PIECES
+#define CNDF_POLY_PIECES 5 // This needs to match on CPU and DPU side!
+#endif
+
+#define REMEZ_ITERATIONS 32
+#define REMEZ_GRID 4096
+
+#define M_PI 3.14159265358979323846
+# define M_SQRT1_2	0.70710678118654752440	/* 1/sqrt(2) */
+
+// The functions as they are fitted, the DPU side evaluates the polynomial at x - 1 (log, sqrt), x - 2.5 (sqrt in fixed point)
+// or at the offset of x in its piece (cndf)
+double log_1p(double t) {
+    return log(1.0 + t);
+}
+
+double sqrt_1p(double t) {
+    return sqrt(1.0 + t);
+}
+
+double sqrt_centered(double t) {
+    return sqrt(2.5 + t);
+}
+
+/*
+ * cndf is fitted piecewise, one polynomial per CNDF_POLY_PIECES-th of [0, CNDF_POLY_RANGE], and to cndf(-x) = erfc(x / sqrt(2)) / 2,
+ * which goes to 0 (the DPU side gets cndf(x) with symmetry_complement). A single polynomial over the whole range converges badly
+ * and its coefficients grow with the degree, and cndf(x) - 0.5 loses the relative precision of the tail.
+ */
+static double cndf_piece_start;
+
+double cndf_negative_piece(double t) {
+    return 0.5 * erfc((cndf_piece_start + t * (CNDF_POLY_RANGE / CNDF_POLY_PIECES)) * M_SQRT1_2);
+}
+
+// Solves the system a * x = b with n unknowns (Gaussian elimination with partial pivoting), the result is written to b
+static void remez_solve(double a[][POLY_MAX_DEGREE + 2], double b[], int n) {
+    for (int column = 0; column < n; column++) {
+        int pivot = column;
+        for (int row = column + 1; row < n; row++) {
+            if (fabs(a[row][column]) > fabs(a[pivot][column])) {
+                pivot = row;
+            }
+        }
+        for (int k = 0; k < n; k++) {
+            double swap = a[column][k];
+            a[column][k] = a[pivot][k];
+            a[pivot][k] = swap;
+        }
+        double swap = b[column];
+        b[column] = b[pivot];
+        b[pivot] = swap;
+
+        for (int row = column + 1; row < n; row++) {
+            double factor = a[row][column] / a[column][column];
+            for (int k = column; k < n; k++) {
+                a[row][k] -= factor * a[column][k];
+            }
+            b[row] -= factor * b[column];
+        }
+    }
+    for (int row = n - 1; row >= 0; row--) {
+        for (int k = row + 1; k < n; k++) {
+            b[row] -= a[row][k] * b[k];
+        }
+        b[row] /= a[row][row];
+    }
+}
+
+static double remez_extrema[REMEZ_GRID + 1]; // Largest error between sign changes of the error
+static double remez_extrema_error[REMEZ_GRID + 1];
+
+static double remez_evaluate(const double coefficients[], int degree, double x) {
+    double y = coefficients[degree];
+    for (int i = degree - 1; i >= 0; i--) {
+        y = y * x + coefficients[i];
+    }
+    return y;
+}
+
+/*
+ * Fits a polynomial of the given degree to original() over [lower, upper] with the Remez exchange algorithm
+ * Outputs
+ * coefficients: degree + 1 coefficients, lowest order first
+ * returns: largest absolute error over the range
+ */
+double remez_fit(double (*original)(double), double lower, double upper, int degree, double coefficients[]) {
+    int n = degree + 2; // Reference points: one more than coefficients, the error alternates in sign between them
+    double reference[POLY_MAX_DEGREE + 2];
+    double a[POLY_MAX_DEGREE + 2][POLY_MAX_DEGREE + 2];
+    double b[POLY_MAX_DEGREE + 2];
+    double best_max_error = INFINITY;
+
+    if (degree < 0 || degree > POLY_MAX_DEGREE) {
+        fprintf(stderr, "Polynomial degree %d is not between 0 and %d\n", degree, POLY_MAX_DEGREE);
+        exit(EXIT_FAILURE);
+    }
+
+    // Start with the extrema of the Chebyshev polynomial, which is already close to the optimum
+    for (int i = 0; i < n; i++) {
+        reference[i] = 0.5 * (lower + upper) - 0.5 * (upper - lower) * cos(M_PI * i / (n - 1));
+    }
+
+    for (int iteration = 0; iteration < REMEZ_ITERATIONS; iteration++) {
+        // Polynomial that has an error of equal size and alternating sign at all reference points
+        for (int i = 0; i < n; i++) {
+            double power = 1;
+            for (int k = 0; k <= degree; k++) {
+                a[i][k] = power;
+                power *= reference[i];
+            }
+            a[i][degree + 1] = (i & 1) ? -1 : 1;
+            b[i] = original(reference[i]);
+        }
+        remez_solve(a, b, n);
+
+        // A singular system (e.g. the error is already at rounding level) gives no usable polynomial, keep the best one so far
+        int singular = 0;
+        for (int k = 0; k <= degree + 1; k++) {
+            singular |= !isfinite(b[k]);
+        }
+        if (singular) {
+            break;
+        }
+
+        // New reference: the largest error between every two sign changes of the error
+        int found = 0;
+        double best_x = lower, best_error = 0;
+        double max_error = 0;
+
+        for (int g = 0; g <= REMEZ_GRID; g++) {
+            double x = lower + (upper - lower) * g / REMEZ_GRID;
+            double error = remez_evaluate(b, degree, x) - original(x);
+
+            max_error = fabs(error) > max_error ? fabs(error) : max_error;
+            if (best_error != 0 && (error > 0) != (best_error > 0)) {
+                remez_extrema[found] = best_x;
+                remez_extrema_error[found++] = best_error;
+                best_error = 0;
+            }
+            if (fabs(error) >= fabs(best_error)) {
+                best_x = x;
+                best_error = error;
+            }
+        }
+        remez_extrema[found] = best_x;
+        remez_extrema_error[found++] = best_error;
+
+        // Once the error is close to rounding level, the iteration can get worse again, so keep the best polynomial
+        if (max_error < best_max_error) {
+            best_max_error = max_error;
+            for (int k = 0; k <= degree; k++) {
+                coefficients[k] = b[k];
+            }
+        }
+
+        // Too many alternations, drop the smaller one at either end
+        int first = 0;
+        while (found - first > n) {
+            if (fabs(remez_extrema_error[first]) < fabs(remez_extrema_error[found - 1])) {
+                first++;
+            } else {
+                found--;
+            }
+        }
+
+        // Not enough alternations (e.g. the error is already at rounding level), keep the last reference
+        if (found - first != n) {
+            break;
+        }
+        for (int i = 0; i < n; i++) {
+            reference[i] = remez_extrema[first + i];
+        }
+    }
+    return best_max_error;
+}
+
+/*
+ * Fits a polynomial and broadcasts its coefficients to the DPUs
+ * Inputs
+ * symbol: name of the coefficient array on the DPU side
+ * piece: index of the polynomial in the coefficient array (0 unless the function is fitted piecewise)
+ * original(): function that should be approximated
+ * lower & upper: input range of the polynomial
+ * degree: degree of the polynomial
+ */
+void broadcast_fit_polynomial(struct dpu_set_t set, const char *symbol, int piece, double (*original)(double), double lower, double upper, int degree) {
+    double coefficients[POLY_MAX_DEGREE + 1];
+    remez_fit(original, lower, upper, degree, coefficients);
+
+#ifdef POLY_MINIMAX_FIXED
+    int32_t dpu_coefficients[POLY_MAX_DEGREE + 1];
+    for (int k = 0; k <= degree; k++) {
+        double fixed = round(ldexp(coefficients[k], FIXED_FRACTION_BITS));
+        if (!(fixed <= INT32_MAX && fixed >= INT32_MIN)) {
+            fprintf(stderr, "Coefficient %d of %s (%g) does not fit into a fixed point number with %d fractional bits\n",
+                    k, symbol, coefficients[k], FIXED_FRACTION_BITS);
+            exit(EXIT_FAILURE);
+        }
+        dpu_coefficients[k] = (int32_t) fixed;
+    }
+#else
+    float dpu_coefficients[POLY_MAX_DEGREE + 1];
+    for (int k = 0; k <= degree; k++) {
+        dpu_coefficients[k] = (float) coefficients[k];
+    }
+#endif
+    DPU_ASSERT(dpu_broadcast_to(set, symbol, sizeof(dpu_coefficients[0]) * (degree + 1) * piece, dpu_coefficients, sizeof(dpu_coefficients[0]) * (degree + 1), DPU_XFER_DEFAULT));
+}
+
+// Generates and Broadcasts all coefficients to the DPU
+void broadcast_tables(struct dpu_set_t set) {
+#ifdef MEASURE
+    double start, end;
+    FILE *out_file = fopen("../microbenchmarks/output/setup.csv", "a");
+    start = clock();
+#endif
+
+#if SIN_COS_TAN_ENABLED > 0
+    broadcast_fit_polynomial(set, "sin_cos_tan_coefficients", 0, sin, 0, M_PI / 2, SIN_COS_TAN_PRECISION);
+#endif
+
+#if EXP_ENABLED > 0
+    broadcast_fit_polynomial(set, "exp_coefficients", 0, exp, 0, log(2), EXP_PRECISION);
+#endif
+
+#if LOG_ENABLED > 0
+#if defined NOWRAP && !defined POLY_MINIMAX_FIXED
+    broadcast_fit_polynomial(set, "log_coefficients", 0, log_1p, -0.5, 1, LOG_PRECISION); // Inputs in [0.5, 2)
+#else
+    broadcast_fit_polynomial(set, "log_coefficients", 0, log_1p, 0, 1, LOG_PRECISION); // Mantissa in [1, 2)
+#endif
+#endif
+
+#if SQRT_ENABLED > 0
+#if defined POLY_MINIMAX_FIXED
+    broadcast_fit_polynomial(set, "sqrt_coefficients", 0, sqrt_centered, -1.5, 1.5, SQRT_PRECISION); // Mantissa in [1, 4), small powers for Estrin
+#elif defined NOWRAP
+    broadcast_fit_polynomial(set, "sqrt_coefficients", 0, sqrt_1p, -0.5, 1, SQRT_PRECISION); // Inputs in [0.5, 2)
+#else
+    broadcast_fit_polynomial(set, "sqrt_coefficients", 0, sqrt_1p, 0, 3, SQRT_PRECISION); // Mantissa in [1, 4)
+#endif
+#endif
+
+#if CNDF_ENABLED > 0
+    for (int piece = 0; piece < CNDF_POLY_PIECES; piece++) {
+        cndf_piece_start = piece * (CNDF_POLY_RANGE / CNDF_POLY_PIECES);
+        broadcast_fit_polynomial(set, "cndf_coefficients", piece, cndf_negative_piece, 0, 1, CNDF_PRECISION); // Offset in the piece
+    }
+#endif
+
+#ifdef MEASURE
+    end = clock();
+    printf("Polynomial Setup Time:                    %.2e secs.\n", (end - start) / CLOCKS_PER_SEC );
+    fprintf(out_file, "poly-minimax_%s, %d, %e\n", storage, PRECISION, (end - start) / CLOCKS_PER_SEC);
+    fclose(out_file);
+#endif
+}
@@ -0,0 +1,52 @@
+#include <stdio.h>
+#include <dpu.h>
+
+/*
+ * Writes the table parameters of a method as compile time constants into a header (see dpu/_table_constants.c)
+ *
+ * Needs to be compiled with the same options as the host and DPU program (method, PRECISION, <NAME>_PRECISION,
+ * <NAME>_ENABLED, ...). It runs broadcast_tables() of the method without a DPU: no table is generated or transferred,
+ * every parameter that would be broadcast is written as #define <NAME>_CONSTANT value instead.
+ * For the methods without table parameters (CORDIC, LUT_DIRECT, POLY_MINIMAX, ...), the header stays empty,
+ * so TABLE_CONSTANTS=1 can be set for every method.
+ *
+ * Basic Usage:
+ *
+ * clang host/table_constants.c -o bin/host/table_constants `dpu-pkg-config --cflags --libs dpu` -lm -pthread -D LUT_LDEXPF_INTERPOLATE ...
+ * bin/host/table_constants bin/table_constants.h
+ */
+
+#if defined LUT_LDEXPF || defined LUT_LDEXPF_INTERPOLATE
+#include "lut_ldexpf_host.c"
+#elif defined LUT_MULTI || defined LUT_MULTI_INTERPOLATE
+#include "lut_multi_host.c"
+#elif defined LUT_FIXED || defined LUT_FIXED_INTERPOLATE
+#include "lut_fixed_host.c"
+#elif defined LUT_SPLINE
+#include "lut_spline_host.c"
+#elif defined LUT_BIPARTITE
+#include "lut_bipartite_host.c"
+#else
+#define NO_TABLE_CONSTANTS // Nothing to write, the DPU program never reads a constant
+static FILE *table_constants_file = NULL;
+#endif
+
+int main(int argc, char **argv) {
+    const char *path = argc > 1 ? argv[1] : "table_constants.h";
+    struct dpu_set_t set = {0}; // Never used, nothing is transferred
+
+    table_constants_file = fopen(path, "w");
+    if (table_constants_file == NULL) {
+        perror(path);
+        return 1;
+    }
+
+    fprintf(table_constants_file, "// Generated by host/table_constants.c, needs to be generated again when the table options change\n");
+#ifndef NO_TABLE_CONSTANTS
+    broadcast_tables(set);
+#endif
+
+    fclose(table_constants_file);
+    table_constants_file = NULL;
+    return 0;
+}
@@ -0,0 +1,117 @@
+#include <mram.h>
+#include <perfcounter.h>
+#include <stdio.h>
+#include <defs.h>
+#include "../../dpu/_ldexpf.c"
+
+/*
+ * Cycles of the fixed point <-> floating point conversions in _ldexpf.c, compared to the previous implementations
+ * (normalization one bit at a time and a branch per direction, kept below for this comparison only).
+ * Every input is a fixed point number, it is converted to floating point and the result back to fixed point,
+ * so both directions see the full range. Results that differ between the old and new version are counted.
+ */
+
+#define CACHE_SIZE 128
+#define BUFFER_SIZE (1 << ARRAY_SIZE)
+
+// Previous implementation of floating_to_fixed()
+int floating_to_fixed_previous(float in) {
+    unsigned int in_binary = * ( unsigned int * ) &in;
+
+    unsigned int part = (in_binary >> FLOAT_MANTISSA_BITS);
+    int current_exponent = (int) part & FLOAT_MAX_EXPONENT;
+
+    if (FLOAT_ZERO_EXPONENT - EXTRA_PRECISION > current_exponent) {
+        in_binary = ((in_binary & FLOAT_MANTISSA_MASK) | FLOAT_OMITTED_BIT) >> (FLOAT_ZERO_EXPONENT - current_exponent - EXTRA_PRECISION);
+    } else {
+        in_binary = ((in_binary & FLOAT_MANTISSA_MASK) | FLOAT_OMITTED_BIT) << (current_exponent - FLOAT_ZERO_EXPONENT + EXTRA_PRECISION);
+    }
+
+    // Make two's complement
+    if (part >> FLOAT_EXPONENT_BITS) in_binary = ~in_binary + 0x1;
+
+    return (int) in_binary;
+}
+
+// Previous implementation of fixed_to_floating()
+float fixed_to_floating_previous(int in) {
+    unsigned int in_binary = * ( unsigned int * ) &in;
+
+    unsigned int sign = in_binary >> (FLOAT_EXPONENT_BITS + FLOAT_MANTISSA_BITS);
+
+    if (sign) in_binary = ~in_binary + 0x1;
+
+    if (in_binary == 0) {
+        return 0.0f;
+    }
+
+    // Normalize too big exponents
+    int exponent = FLOAT_ZERO_EXPONENT - 1 - EXTRA_PRECISION;
+    while(in_binary > (FLOAT_OMITTED_BIT << 1)) {
+        ++exponent;
+        in_binary >>= 1;
+    }
+
+    // Normalize too small exponents
+    while(in_binary < FLOAT_OMITTED_BIT) {
+        --exponent;
+        in_binary <<= 1;
+    }
+
+    // Combine sign, mantissa and exponent
+    in_binary += (exponent << FLOAT_MANTISSA_BITS) + (sign << (FLOAT_EXPONENT_BITS + FLOAT_MANTISSA_BITS));
+
+    return  * ( float * ) &in_binary;
+}
+
+__mram_noinit int buffer[BUFFER_SIZE];
+__host uint32_t to_floating_previous_count;
+__host uint32_t to_floating_count;
+__host uint32_t to_fixed_previous_count;
+__host uint32_t to_fixed_count;
+__host uint32_t mismatches;
+
+int main(){
+
+    to_floating_previous_count = 0;
+    to_floating_count = 0;
+    to_fixed_previous_count = 0;
+    to_fixed_count = 0;
+    mismatches = 0;
+    __dma_aligned int local_cache[CACHE_SIZE];
+
+    printf("Operations Tested:                        %d\n", BUFFER_SIZE);
+
+    // volatile, so that the compiler can not move the conversions out of the measured regions
+    volatile int x, fixed_previous, fixed;
+    volatile float floating_previous, floating;
+    for (unsigned int bytes_read = 0; bytes_read < BUFFER_SIZE; bytes_read += CACHE_SIZE) {
+
+        mram_read(&buffer[bytes_read], local_cache, sizeof(int) * CACHE_SIZE);
+
+        for (unsigned int byte_index = 0; (byte_index < CACHE_SIZE) && (bytes_read + byte_index < BUFFER_SIZE); byte_index++) {
+
+            x = local_cache[byte_index];
+
+            perfcounter_config(COUNT_CYCLES, true);
+            floating_previous = fixed_to_floating_previous(x);
+            to_floating_previous_count += perfcounter_get();
+
+            perfcounter_config(COUNT_CYCLES, true);
+            floating = fixed_to_floating(x);
+            to_floating_count += perfcounter_get();
+
+            perfcounter_config(COUNT_CYCLES, true);
+            fixed_previous = floating_to_fixed_previous(floating);
+            to_fixed_previous_count += perfcounter_get();
+
+            perfcounter_config(COUNT_CYCLES, true);
+            fixed = floating_to_fixed(floating);
+            to_fixed_count += perfcounter_get();
+
+            mismatches += (floating != floating_previous) + (fixed != fixed_previous);
+        }
+    }
+
+    return 0;
+}
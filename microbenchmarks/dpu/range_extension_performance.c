@@ -2,6 +2,7 @@
 #include <perfcounter.h>
 #include <stdio.h>
 #include "../../dpu/_range_extensions.c"
+#include "../../dpu/_argument_reduction.c"
 
 #define CACHE_SIZE 128
 #define BUFFER_SIZE (1 << ARRAY_SIZE)
@@ -30,8 +31,8 @@ int main(){
 
             perfcounter_config(COUNT_CYCLES, true);
 
-            #ifdef SIN
-                out = sin_cos_tan_range_extension_in(x);
+            #if defined SIN || defined SIN_LARGE
+                out = sin_cos_tan_reduction(x); // Selected with SIN_COS_TAN_REDUCTION (see _argument_reduction.c)
             #elif defined EXP
                 out = exp_range_extension_out(exp_range_extension_in(x, &extra_data),  &extra_data);
             #elif defined LOG
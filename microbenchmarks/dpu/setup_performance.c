@@ -19,6 +19,12 @@
     #include "../../dpu/lut_direct.c"
 #elif defined LUT_DIRECT_LDEXPF
     #include "../../dpu/lut_direct_ldexpf.c"
+#elif defined LUT_SPLINE
+    #include "../../dpu/lut_spline.c"
+#elif defined LUT_BIPARTITE
+    #include "../../dpu/lut_bipartite.c"
+#elif defined POLY_MINIMAX
+    #include "../../dpu/poly_minimax.c"
 #endif
 
 int main(){
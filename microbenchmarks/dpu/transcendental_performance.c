@@ -16,6 +16,7 @@
     #define SQRT_STORE_IN_WRAM STORE_IN_WRAM
 #elif defined TANH
     #define TANH_STORE_IN_WRAM STORE_IN_WRAM
+    #define SINH_COSH_TANH_STORE_IN_WRAM STORE_IN_WRAM
 #elif defined GELU
     #define GELU_STORE_IN_WRAM STORE_IN_WRAM
 #else
@@ -39,6 +40,12 @@
     #include "../../dpu/lut_direct.c"
 #elif defined LUT_DIRECT_LDEXPF
     #include "../../dpu/lut_direct_ldexpf.c"
+#elif defined LUT_SPLINE
+    #include "../../dpu/lut_spline.c"
+#elif defined LUT_BIPARTITE
+    #include "../../dpu/lut_bipartite.c"
+#elif defined POLY_MINIMAX
+    #include "../../dpu/poly_minimax.c"
 #endif
 
 #define CACHE_SIZE 128
@@ -49,6 +56,9 @@ __mram_noinit float buffer[BUFFER_SIZE];
 __host uint32_t performance_count;
 
 int main(){
+#ifdef TABLE_STAGING_DPU
+    table_staging();
+#endif
 
     performance_count = 0;
     __dma_aligned float local_cache[CACHE_SIZE];
@@ -15,6 +15,7 @@
     #define SQRT_STORE_IN_WRAM STORE_IN_WRAM
 #elif defined TANH
     #define TANH_STORE_IN_WRAM STORE_IN_WRAM
+    #define SINH_COSH_TANH_STORE_IN_WRAM STORE_IN_WRAM
 #elif defined GELU
     #define GELU_STORE_IN_WRAM STORE_IN_WRAM
 #elif defined CNDF
@@ -31,6 +32,8 @@
     #include "../../dpu/lut_fixed.c"
 #elif defined LUT_FIXED_INTERPOLATE
     #include "../../dpu/lut_fixed_interpolate.c"
+#elif defined POLY_MINIMAX_FIXED
+    #include "../../dpu/poly_minimax_fixed.c"
 #endif
 
 
@@ -41,6 +44,9 @@ __mram_noinit int buffer[BUFFER_SIZE];
 __host uint32_t performance_count;
 
 int main(){
+#ifdef TABLE_STAGING_DPU
+    table_staging();
+#endif
 
     performance_count = 0;
     __dma_aligned int local_cache[CACHE_SIZE];
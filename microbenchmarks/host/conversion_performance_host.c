@@ -0,0 +1,78 @@
+#include <assert.h>
+#include <dpu.h>
+#include <dpu_log.h>
+#include <stdio.h>
+#include <time.h>
+
+#if COUNT_INSTR > 0
+    char perf[]="instructions";
+#else
+    char perf[]="cycles";
+#endif
+
+#ifndef DPU_BINARY
+#define DPU_BINARY "./bin/dpu/conversion_performance"
+#endif
+
+#define BUFFER_SIZE (1 << ARRAY_SIZE)
+
+/*
+ * Fixed point inputs over the full range: every magnitude (position of the highest set bit) gets the same share
+ * of the inputs, with both signs and different lower bits. Evenly spaced inputs would almost only test large magnitudes.
+ */
+void populate_mram(struct dpu_set_t set, int input_buffer[]) {
+    unsigned int lower_bits = 0x9E3779B9;
+    for (int byte_index = 0; byte_index < BUFFER_SIZE; byte_index++) {
+        int highest_bit = byte_index % 31;
+        lower_bits = lower_bits * 1664525 + 1013904223;
+
+        int x = (1 << highest_bit) | (int) (lower_bits & ((1u << highest_bit) - 1));
+        input_buffer[byte_index] = (byte_index / 31) & 1 ? -x : x;
+    }
+    input_buffer[0] = 0;
+    DPU_ASSERT(dpu_broadcast_to(set, "buffer", 0, input_buffer, sizeof(int) * BUFFER_SIZE, DPU_XFER_DEFAULT));
+}
+
+int main(void) {
+    static int input_buffer[BUFFER_SIZE];
+    struct dpu_set_t set, dpu;
+
+    DPU_ASSERT(dpu_alloc(1, NULL, &set));
+    DPU_ASSERT(dpu_load(set, DPU_BINARY, NULL));
+
+    populate_mram(set, input_buffer);
+
+    double start = clock();
+    DPU_ASSERT(dpu_launch(set, DPU_SYNCHRONOUS));
+    double end = clock();
+
+    uint32_t to_floating_previous_count, to_floating_count, to_fixed_previous_count, to_fixed_count, mismatches;
+    DPU_FOREACH(set, dpu) {
+        DPU_ASSERT(dpu_log_read(dpu, stdout));
+        DPU_ASSERT(dpu_copy_from(dpu, "to_floating_previous_count", 0, &to_floating_previous_count, sizeof(uint32_t)));
+        DPU_ASSERT(dpu_copy_from(dpu, "to_floating_count", 0, &to_floating_count, sizeof(uint32_t)));
+        DPU_ASSERT(dpu_copy_from(dpu, "to_fixed_previous_count", 0, &to_fixed_previous_count, sizeof(uint32_t)));
+        DPU_ASSERT(dpu_copy_from(dpu, "to_fixed_count", 0, &to_fixed_count, sizeof(uint32_t)));
+        DPU_ASSERT(dpu_copy_from(dpu, "mismatches", 0, &mismatches, sizeof(uint32_t)));
+    }
+
+    DPU_ASSERT(dpu_free(set));
+
+    FILE *out_file = fopen("output/conversion.csv", "a");
+    fprintf(out_file, "fixed-to-floating-previous_%s, %.2f\n", perf, (float) to_floating_previous_count / (float) BUFFER_SIZE);
+    fprintf(out_file, "fixed-to-floating_%s, %.2f\n", perf, (float) to_floating_count / (float) BUFFER_SIZE);
+    fprintf(out_file, "floating-to-fixed-previous_%s, %.2f\n", perf, (float) to_fixed_previous_count / (float) BUFFER_SIZE);
+    fprintf(out_file, "floating-to-fixed_%s, %.2f\n", perf, (float) to_fixed_count / (float) BUFFER_SIZE);
+    fclose(out_file);
+
+    // Printouts
+    printf("fixed_to_floating() previous per Iteration: %.2f %s\n", (float) to_floating_previous_count / (float) BUFFER_SIZE, perf);
+    printf("fixed_to_floating() per Iteration:          %.2f %s\n", (float) to_floating_count / (float) BUFFER_SIZE, perf);
+    printf("floating_to_fixed() previous per Iteration: %.2f %s\n", (float) to_fixed_previous_count / (float) BUFFER_SIZE, perf);
+    printf("floating_to_fixed() per Iteration:          %.2f %s\n", (float) to_fixed_count / (float) BUFFER_SIZE, perf);
+    printf("Results that differ:                        %u\n\n", mismatches);
+
+    printf("Host elapsed time:                          %.2e secs.\n\n", (end - start) / CLOCKS_PER_SEC );
+
+    return mismatches == 0 ? 0 : 1;
+}
@@ -7,6 +7,8 @@
 
 #ifdef SIN
     char operation[]= "sin";
+#elif defined SIN_LARGE
+    char operation[]= "sin-large";
 #elif defined EXP
     char operation[]= "exp";
 #elif defined LOG
@@ -15,6 +17,10 @@
     char operation[]= "sqrt";
 #endif
 
+#ifndef SIN_COS_TAN_REDUCTION
+#define SIN_COS_TAN_REDUCTION 2 // Only for the output, needs to match on CPU and DPU side!
+#endif
+
 #if COUNT_INSTR > 0
     char perf[]="instructions";
 #else
@@ -49,6 +55,8 @@ void populate_mram(struct dpu_set_t set, float input_buffer[]) {
                 theta_rad = distribute(-20, 20, byte_index, BUFFER_SIZE);
         #elif defined SQRT
                 theta_rad = distribute(offset, 10000, byte_index, BUFFER_SIZE);
+        #elif defined SIN_LARGE
+                theta_rad = ldexpf(distribute(-1, 1, byte_index, BUFFER_SIZE), byte_index % 100); // Up to 2^100
         #else
                 theta_rad = distribute(offset, 4 * M_PI * factor, byte_index, BUFFER_SIZE);
         #endif
@@ -87,7 +95,11 @@ int main(void) {
     DPU_ASSERT(dpu_free(set));
 
     FILE *out_file = fopen("output/extension.csv", "a");
+#if defined SIN || defined SIN_LARGE
+    fprintf(out_file, "%s-reduction%d_%s, %.2f\n", operation, SIN_COS_TAN_REDUCTION, perf, (float) performance_count / (float) BUFFER_SIZE);
+#else
     fprintf(out_file, "%s_%s, %.2f\n", operation, perf, (float) performance_count / (float) BUFFER_SIZE);
+#endif
 
     // Printouts
     #if COUNT_INSTR > 0
@@ -37,6 +37,15 @@
 #elif defined LUT_DIRECT_LDEXPF
 #include "../../host/lut_direct_ldexpf_host.c"
     char method[]="lut-direct-ldexpf-interpolate";
+#elif defined LUT_SPLINE
+#include "../../host/lut_spline_host.c"
+    char method[]="lut-spline";
+#elif defined LUT_BIPARTITE
+#include "../../host/lut_bipartite_host.c"
+    char method[]="lut-bipartite";
+#elif defined POLY_MINIMAX
+#include "../../host/poly_minimax_host.c"
+    char method[]="poly-minimax";
 #endif
 
 #ifndef DPU_BINARY
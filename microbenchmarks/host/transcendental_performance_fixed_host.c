@@ -19,6 +19,9 @@
 #elif defined LUT_FIXED_INTERPOLATE
 #include "../../host/lut_fixed_host.c"
     char method[]="lut-fixed-interpolate";
+#elif defined POLY_MINIMAX_FIXED
+#include "../../host/poly_minimax_host.c"
+    char method[]="poly-minimax-fixed";
 #endif
 
 #ifdef COS
@@ -50,7 +53,11 @@ char operation[]= "sin";
 double (*original)() = sin;
 #endif
 
-#if STORE_IN_WRAM > 0
+// Staged tables are only available for the interpolated LUT methods (see dpu/_table_staging.c)
+#if STORE_IN_WRAM > 1 && defined LUT_FIXED_INTERPOLATE
+#define TABLE_STAGING 1
+    char storage[]="staged";
+#elif STORE_IN_WRAM > 0
     char storage[]="wram";
 #else
     char storage[]="mram";
@@ -62,6 +69,9 @@ double (*original)() = sin;
     char perf[]="cycles";
 #endif
 
+#ifdef TABLE_STAGING
+#include "../../host/_table_staging_host.c"
+#endif
 
 #ifndef DPU_BINARY
 #define DPU_BINARY "bin/dpu/transcendental_performance_fixed"
@@ -162,6 +172,10 @@ int main(void) {
         DPU_ASSERT(dpu_copy_from(dpu, "buffer", 0, &output_buffer, sizeof(float) * BUFFER_SIZE));
     }
 
+#ifdef TABLE_STAGING
+    table_staging_print_stats(set);
+#endif
+
     DPU_ASSERT(dpu_free(set));
 
     double error, ulp_error;
@@ -42,7 +42,11 @@ double gelu(double x) {
     double (*original)() = sin;
 #endif
 
-#if STORE_IN_WRAM > 0
+// Staged tables are only available for the interpolated LUT methods (see dpu/_table_staging.c)
+#if STORE_IN_WRAM > 1 && (defined LUT_LDEXPF_INTERPOLATE || defined LUT_MULTI_INTERPOLATE)
+#define TABLE_STAGING 1
+    char storage[]="staged";
+#elif STORE_IN_WRAM > 0
     char storage[]="wram";
 #else
     char storage[]="mram";
@@ -78,6 +82,23 @@ double gelu(double x) {
 #elif defined LUT_DIRECT_LDEXPF
 #include "../../host/lut_direct_ldexpf_host.c"
     char method[]="lut-direct-ldexpf-interpolate";
+#elif defined LUT_SPLINE
+#include "../../host/lut_spline_host.c"
+    char method[]="lut-spline";
+#elif defined LUT_BIPARTITE
+#include "../../host/lut_bipartite_host.c"
+    char method[]="lut-bipartite";
+#elif defined POLY_MINIMAX
+#include "../../host/poly_minimax_host.c"
+    char method[]="poly-minimax";
+#endif
+
+#if TABLE_CACHE > 0
+#include "../../host/_table_cache_host.c"
+#endif
+
+#ifdef TABLE_STAGING
+#include "../../host/_table_staging_host.c"
 #endif
 
 #ifndef DPU_BINARY
@@ -174,6 +195,14 @@ int main(void) {
         DPU_ASSERT(dpu_copy_from(dpu, "buffer", 0, &output_buffer, sizeof(float) * BUFFER_SIZE));
     }
 
+#if TABLE_CACHE > 0
+    table_cache_print_stats(set);
+#endif
+
+#ifdef TABLE_STAGING
+    table_staging_print_stats(set);
+#endif
+
     DPU_ASSERT(dpu_free(set));
 
     // Calculate the recieved precision
@@ -0,0 +1,8 @@
+#!/bin/bash
+
+cat /dev/null > output/conversion.csv
+
+make conversion_performance
+wait
+./bin/host/conversion_performance_host
+wait
@@ -9,3 +9,15 @@ do
     ./../bin/host/range_extension_performance_host
     wait
 done
+
+# Argument reductions of sin / cos / tan, for small and large inputs
+for r in 0 1 2
+do
+  for t in SIN SIN_LARGE
+  do
+      SIN_COS_TAN_REDUCTION=$r OPERATION=$t make extension_performance
+      wait
+      ./../bin/host/range_extension_performance_host
+      wait
+  done
+done
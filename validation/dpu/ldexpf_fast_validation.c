@@ -0,0 +1,57 @@
+#include <assert.h>
+#include <stdio.h>
+#include "../../dpu/_ldexpf.c"
+
+#define FLOAT_BITS(x) (* ( unsigned int * ) &(x))
+
+/*
+ * ldexpf_fast() and frexpf_fast() need to give bit-identical results to ldexpf() and frexpf() for normal inputs (and zero)
+ * as long as the result of ldexpf() is normal as well
+ */
+int main() {
+    // Some simple cases first
+    assert(ldexpf_fast(1.5f, 1) == 3.0f);
+    assert(ldexpf_fast(-1.5f, -1) == -0.75f);
+    assert(ldexpf_fast(1.00000011920928955078125f, 1) == 2.0000002384185791015625);
+    assert(ldexpf_fast(1.0f, 127) == 170141183460469231731687303715884105728.0f);
+    assert(ldexpf_fast(0.0f, 127) == 0.0f);
+    assert(ldexpf_fast(-0.0f, -127) == -0.0f);
+    printf("Basic ldexpf_fast Tests Work\n");
+
+    // Every exponent and sign, with mantissas spread over the whole range
+    unsigned int tested = 0;
+    for (unsigned int exponent_bits = 1; exponent_bits < FLOAT_MAX_EXPONENT; ++exponent_bits) {
+        for (unsigned int mantissa = 0; mantissa <= FLOAT_MANTISSA_MASK; mantissa += 0x1FFFF) {
+            for (unsigned int sign = 0; sign < 2; ++sign) {
+                unsigned int in_binary = (sign << (FLOAT_TOTAL_BITS - 1)) | (exponent_bits << FLOAT_MANTISSA_BITS) | mantissa;
+                float in = * ( float * ) &in_binary;
+
+                // All exponent changes that keep the result normal
+                for (int exponent = 1 - (int) exponent_bits; exponent < FLOAT_MAX_EXPONENT - (int) exponent_bits; exponent += 7) {
+                    float out = ldexpf(in, exponent);
+                    float out_fast = ldexpf_fast(in, exponent);
+                    assert(FLOAT_BITS(out) == FLOAT_BITS(out_fast));
+                    ++tested;
+                }
+
+                int frexpf_exponent, frexpf_fast_exponent;
+                float mantissa_out = frexpf(in, &frexpf_exponent);
+                float mantissa_out_fast = frexpf_fast(in, &frexpf_fast_exponent);
+                assert(FLOAT_BITS(mantissa_out) == FLOAT_BITS(mantissa_out_fast));
+                assert(frexpf_exponent == frexpf_fast_exponent);
+            }
+        }
+    }
+    printf("ldexpf_fast and frexpf_fast are bit-identical for %u normal inputs\n", tested);
+
+    // Zero stays zero (with its sign) and gets the same exponent as from frexpf()
+    float zeros[] = {0.0f, -0.0f};
+    for (int i = 0; i < 2; ++i) {
+        int frexpf_exponent, frexpf_fast_exponent;
+        float mantissa_out = frexpf(zeros[i], &frexpf_exponent);
+        float mantissa_out_fast = frexpf_fast(zeros[i], &frexpf_fast_exponent);
+        assert(FLOAT_BITS(mantissa_out) == FLOAT_BITS(mantissa_out_fast));
+        assert(frexpf_exponent == frexpf_fast_exponent);
+    }
+    printf("Zero Works\n");
+}